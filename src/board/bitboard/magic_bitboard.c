@@ -0,0 +1,359 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+/*! @addtogroup OccupancyMasks
+ *
+ * @ingroup OccupancyMasks
+ * @{
+ * @details Sliding piece (Rook/Bishop/Queen) attack lookup using "fancy" magic bitboards.
+ *
+ * For each square, the relevant blocker squares are masked out of the board occupancy, multiplied by
+ * a magic number, and the top bits of the product used as an index into a pre-calculated attack table.
+ * See https://www.chessprogramming.org/Magic_Bitboards
+ *
+ * On x86-64 hosts with BMI2, the multiply/shift is replaced with a single PEXT of the
+ * occupancy against the mask (see https://www.chessprogramming.org/BMI2#PEXTBitboards).
+ * Both schemes produce an index in [0, 2^bits), so the table layout is shared and only the
+ * contents are rebuilt when the backend changes. The backend is selected once at startup
+ * based on the host CPU. AMD CPUs before Zen 3 (family 19h) report BMI2 but implement PEXT in
+ * microcode, where it's much slower than the magic multiply, so they keep the magic backend.
+ *
+ */
+
+#include "bitboard.h"
+#include "occupancy_mask.h"
+#include "square.h"
+#include "utils.h"
+#include <assert.h>
+#include <pthread.h>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#define PEXT_AVAILABLE
+// first AMD family (Zen 3) with PEXT in hardware
+#define AMD_FAST_PEXT_FAMILY 0x19
+#endif
+#include <stdbool.h>
+#include <stdint.h>
+
+struct magic {
+    uint64_t *attacks;
+    uint64_t mask;
+    uint64_t magic;
+    uint8_t shift;
+};
+
+struct direction {
+    int rank_delta;
+    int file_delta;
+};
+
+// size of the attack tables, being the sum over all squares of 2^(num relevant occupancy bits)
+#define ROOK_ATTACK_TABLE_SIZE (102400)
+#define BISHOP_ATTACK_TABLE_SIZE (5248)
+
+static void init_magics(struct magic magics[NUM_SQUARES], uint64_t *attack_table, const uint64_t magic_nums[NUM_SQUARES],
+                        const struct direction dirs[4]);
+static void init_slider_attacks(void);
+static void build_attack_tables(void);
+static inline uint64_t get_attack_index(const struct magic *const m, const uint64_t occupied);
+static uint64_t gen_slider_attacks(enum square sq, uint64_t occupied, const struct direction dirs[4]);
+static uint64_t get_edges_mask(enum square sq);
+
+// clang-format off
+static const struct direction ROOK_DIRECTIONS[4]   = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+static const struct direction BISHOP_DIRECTIONS[4] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+// Magic multipliers, found offline using a sparse random search
+// (see https://www.chessprogramming.org/Looking_for_Magics)
+static const uint64_t ROOK_MAGIC_NUMS[NUM_SQUARES] = {
+    0x1080004008801020ULL, 0x0840092002c03000ULL, 0x1900200010400900ULL, 0x0880100008000480ULL,
+    0x4200100420080200ULL, 0x8100020100080400ULL, 0x0200040110886200ULL, 0x0200008040220411ULL,
+    0x0404800084400220ULL, 0x0000401000402000ULL, 0x0086001081220440ULL, 0x0408800800100280ULL,
+    0x000a001201040820ULL, 0x8848800200840080ULL, 0x4001000100040200ULL, 0x0442000102105084ULL,
+    0x9080010020804100ULL, 0x0040404000201009ULL, 0x0000808010002009ULL, 0x2200090021d00100ULL,
+    0x0008008008040080ULL, 0x0004004002010040ULL, 0x0011040008015042ULL, 0x00000a0001768104ULL,
+    0x0000800080204009ULL, 0x2010004140002001ULL, 0x9800200280100080ULL, 0x1000100080080080ULL,
+    0x0442000a00049020ULL, 0x2100040080020080ULL, 0x0800120400900148ULL, 0x0010040a00128541ULL,
+    0x2800804000800030ULL, 0x1010002000400041ULL, 0x4000200011004100ULL, 0x0610008410800800ULL,
+    0x0400802402800800ULL, 0xc100020080800400ULL, 0x0002000802000401ULL, 0x0182085882000401ULL,
+    0x0220204000808000ULL, 0x2860100040024022ULL, 0x0001002004110040ULL, 0x99101042000a0020ULL,
+    0x0004080004008080ULL, 0x0010040002008080ULL, 0x2012004881020004ULL, 0x8300842444820011ULL,
+    0x0088403882010200ULL, 0x0820400080210100ULL, 0x0110910040a00300ULL, 0x0801100280080480ULL,
+    0x0242009008200600ULL, 0x1002000489500200ULL, 0x0040800200010080ULL, 0x0091800041000080ULL,
+    0x0000209300488001ULL, 0x04c1002414824001ULL, 0x020020000b001041ULL, 0x7000100004200901ULL,
+    0x8002002004100802ULL, 0x30010002084c0007ULL, 0x0888221800813004ULL, 0x4000002840840112ULL,};
+
+static const uint64_t BISHOP_MAGIC_NUMS[NUM_SQUARES] = {
+    0xa010041108003100ULL, 0x006082020a002900ULL, 0x6810010619200000ULL, 0x08281a0520000408ULL,
+    0x0001104001000400ULL, 0x0018901008048400ULL, 0x00040a0210245280ULL, 0x000200210808a402ULL,
+    0x9140048410821200ULL, 0x0800091010820041ULL, 0x20504804832202c0ULL, 0x0100091401081000ULL,
+    0x8021011140000012ULL, 0x0810020804450400ULL, 0x208b0542109008a2ULL, 0x0080084a08040204ULL,
+    0x0040e2a80811244cULL, 0x2505022008008108ULL, 0x0430220100420040ULL, 0x010a040420220040ULL,
+    0x1105000290400000ULL, 0x0093001200822120ULL, 0x4000a62048043004ULL, 0x280120048a015004ULL,
+    0x006090002a020814ULL, 0x44042000240800d0ULL, 0x01102800040a4400ULL, 0x1004080080220040ULL,
+    0x0001001011004024ULL, 0x0010044000805040ULL, 0x0914041200820100ULL, 0x0004821012821480ULL,
+    0x0024040500c05021ULL, 0x0088611002080200ULL, 0x0116080a00040020ULL, 0x4000020080080080ULL,
+    0x2450450140840040ULL, 0x0000880201484100ULL, 0x0222020404020092ULL, 0x8081110600002e00ULL,
+    0x2842101105000801ULL, 0x1100809008001025ULL, 0x00020202221c0400ULL, 0x0422014022009020ULL,
+    0x0210046102100c00ULL, 0xc004008082029102ULL, 0x00aa461801101200ULL, 0x0404080080201108ULL,
+    0x020542108c205002ULL, 0x0410544804100100ULL, 0x0040910841100000ULL, 0x0400200042021100ULL,
+    0x00004204850400c0ULL, 0x0200100410a42102ULL, 0x1040020801210102ULL, 0x0805040410420000ULL,
+    0x2884804130100200ULL, 0x800c262201242000ULL, 0x1058000194108800ULL, 0x0014221054420204ULL,
+    0x0104000012a02200ULL, 0x0200881003300100ULL, 0x0140400202840100ULL, 0x0402020801010201ULL,};
+
+static struct magic rook_magics[NUM_SQUARES]                    = {0};
+static struct magic bishop_magics[NUM_SQUARES]                  = {0};
+static uint64_t rook_attack_table[ROOK_ATTACK_TABLE_SIZE]       = {0};
+static uint64_t bishop_attack_table[BISHOP_ATTACK_TABLE_SIZE]   = {0};
+static bool slider_attacks_initialised                          = false;
+static pthread_once_t slider_attacks_once                       = PTHREAD_ONCE_INIT;
+static enum slider_attack_backend slider_backend                = SLIDER_BACKEND_MAGIC;
+// clang-format on
+
+/**
+ * @brief       Populates the Rook and Bishop magic attack tables
+ * @details     The tables don't change, so they're only populated on the first call. Safe to call from
+ *              several threads at once; callers that race wait for the first one to finish.
+ */
+void occ_mask_init_slider_attacks(void) {
+    if (pthread_once(&slider_attacks_once, init_slider_attacks) != 0) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Failed to initialise the slider attacks");
+    }
+}
+
+/**
+ * @brief       Tests whether the host CPU can use the PEXT slider attack backend
+ *
+ * @return true if BMI2 PEXT is available, false otherwise
+ */
+bool occ_mask_is_pext_supported(void) {
+#if defined(PEXT_AVAILABLE)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") != 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief       Tests whether PEXT is supported and implemented in hardware, so it's faster than the magic multiply
+ *
+ * @return true if the PEXT backend should be preferred, false otherwise
+ */
+bool occ_mask_is_pext_fast(void) {
+#if defined(PEXT_AVAILABLE)
+    if (!occ_mask_is_pext_supported()) {
+        return false;
+    }
+    if (!__builtin_cpu_is("amd")) {
+        return true;
+    }
+
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    // the extended family is only added when the base family is 0xF
+    const unsigned int base_family = (eax >> 8) & 0xF;
+    const unsigned int family = base_family == 0xF ? base_family + ((eax >> 20) & 0xFF) : base_family;
+    return family >= AMD_FAST_PEXT_FAMILY;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief           Selects the indexing scheme used for the slider attack tables, and rebuilds the tables
+ * @details         Intended for benchmarking/testing; normally the backend is chosen on initialisation.
+ *
+ * @param backend   The backend to use
+ * @return true if the backend was selected, false if it isn't supported by the host CPU
+ */
+bool occ_mask_set_slider_backend(enum slider_attack_backend backend) {
+    assert(slider_attacks_initialised);
+
+    switch (backend) {
+    case SLIDER_BACKEND_MAGIC:
+        break;
+    case SLIDER_BACKEND_PEXT:
+        if (!occ_mask_is_pext_supported()) {
+            return false;
+        }
+        break;
+    default:
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid slider attack backend");
+        break;
+    }
+
+    slider_backend = backend;
+    build_attack_tables();
+    return true;
+}
+
+/**
+ * @brief       Returns the indexing scheme currently in use for the slider attack tables
+ *
+ * @return The current backend
+ */
+enum slider_attack_backend occ_mask_get_slider_backend(void) {
+    return slider_backend;
+}
+
+/**
+ * @brief               Returns the squares attacked by a Rook on the given square
+ *
+ * @param sq            The square containing the Rook
+ * @param occupied      Bitboard of all occupied squares
+ * @return A bitboard of attacked squares, including the first blocker in each direction
+ */
+uint64_t occ_mask_get_rook_attacks(enum square sq, uint64_t occupied) {
+    assert(validate_square(sq));
+    assert(slider_attacks_initialised);
+
+    const struct magic *const m = &rook_magics[sq];
+    return m->attacks[get_attack_index(m, occupied)];
+}
+
+/**
+ * @brief               Returns the squares attacked by a Bishop on the given square
+ *
+ * @param sq            The square containing the Bishop
+ * @param occupied      Bitboard of all occupied squares
+ * @return A bitboard of attacked squares, including the first blocker in each direction
+ */
+uint64_t occ_mask_get_bishop_attacks(enum square sq, uint64_t occupied) {
+    assert(validate_square(sq));
+    assert(slider_attacks_initialised);
+
+    const struct magic *const m = &bishop_magics[sq];
+    return m->attacks[get_attack_index(m, occupied)];
+}
+
+/**
+ * @brief               Returns the squares attacked by a Queen on the given square
+ *
+ * @param sq            The square containing the Queen
+ * @param occupied      Bitboard of all occupied squares
+ * @return A bitboard of attacked squares, including the first blocker in each direction
+ */
+uint64_t occ_mask_get_queen_attacks(enum square sq, uint64_t occupied) {
+    return occ_mask_get_rook_attacks(sq, occupied) | occ_mask_get_bishop_attacks(sq, occupied);
+}
+
+// ==================================================================
+//
+// private functions
+//
+// ==================================================================
+
+#if defined(PEXT_AVAILABLE)
+// Emitted directly rather than via _pext_u64() so the binary doesn't need to be built
+// with -mbmi2; the instruction is only executed once BMI2 support has been confirmed.
+static inline uint64_t pext_u64(const uint64_t src, const uint64_t mask) {
+    uint64_t dest;
+    __asm__("pextq %2, %1, %0" : "=r"(dest) : "r"(src), "rm"(mask));
+    return dest;
+}
+#endif
+
+static inline uint64_t get_attack_index(const struct magic *const m, const uint64_t occupied) {
+#if defined(PEXT_AVAILABLE)
+    if (slider_backend == SLIDER_BACKEND_PEXT) {
+        return pext_u64(occupied, m->mask);
+    }
+#endif
+    return ((occupied & m->mask) * m->magic) >> m->shift;
+}
+
+static void init_slider_attacks(void) {
+    slider_backend = occ_mask_is_pext_fast() ? SLIDER_BACKEND_PEXT : SLIDER_BACKEND_MAGIC;
+    build_attack_tables();
+
+    slider_attacks_initialised = true;
+}
+
+static void build_attack_tables(void) {
+    init_magics(rook_magics, rook_attack_table, ROOK_MAGIC_NUMS, ROOK_DIRECTIONS);
+    init_magics(bishop_magics, bishop_attack_table, BISHOP_MAGIC_NUMS, BISHOP_DIRECTIONS);
+}
+
+static void init_magics(struct magic magics[NUM_SQUARES], uint64_t *attack_table, const uint64_t magic_nums[NUM_SQUARES],
+                        const struct direction dirs[4]) {
+    uint64_t *next_free = attack_table;
+
+    for (enum square sq = a1; sq <= h8; sq++) {
+        struct magic *const m = &magics[sq];
+
+        // board edges don't affect the attacks, so exclude them from the relevant occupancy
+        m->mask = gen_slider_attacks(sq, 0, dirs) & ~get_edges_mask(sq);
+        m->magic = magic_nums[sq];
+        m->shift = (uint8_t)(64 - __builtin_popcountll(m->mask));
+        m->attacks = next_free;
+
+        // enumerate all subsets of the mask (Carry-Rippler) and store the attacks for each
+        uint64_t subset = 0;
+        do {
+            m->attacks[get_attack_index(m, subset)] = gen_slider_attacks(sq, subset, dirs);
+            subset = (subset - m->mask) & m->mask;
+        } while (subset != 0);
+
+        next_free += (uint64_t)1 << (64 - m->shift);
+    }
+}
+
+static uint64_t gen_slider_attacks(enum square sq, uint64_t occupied, const struct direction dirs[4]) {
+    uint64_t attacks = 0;
+    const enum rank sq_rank = sq_get_rank(sq);
+    const enum file sq_file = sq_get_file(sq);
+
+    for (int d = 0; d < 4; d++) {
+        int rank = (int)sq_rank + dirs[d].rank_delta;
+        int file = (int)sq_file + dirs[d].file_delta;
+
+        while (sq_is_valid_rank((enum rank)rank) && sq_is_valid_file((enum file)file)) {
+            const enum square dest_sq = sq_gen_from_rank_file((enum rank)rank, (enum file)file);
+            attacks |= SQUARE_AS_BITBOARD(dest_sq);
+            if (bb_is_set(occupied, dest_sq)) {
+                // blocked
+                break;
+            }
+            rank += dirs[d].rank_delta;
+            file += dirs[d].file_delta;
+        }
+    }
+    return attacks;
+}
+
+static uint64_t get_edges_mask(enum square sq) {
+    const uint64_t rank_1_8 = RANK_MASK | (RANK_MASK << 56);
+    const uint64_t file_a_h = FILE_A_BB | FILE_H_BB;
+
+    return (rank_1_8 & ~occ_mask_get_horizontal(sq)) | (file_a_h & ~occ_mask_get_vertical(sq));
+}
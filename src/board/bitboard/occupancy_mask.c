@@ -34,33 +34,20 @@
 
 #include "occupancy_mask.h"
 #include "bitboard.h"
+#include "occupancy_mask_tables.h"
 #include "piece.h"
 #include "square.h"
 #include <assert.h>
 
-static uint64_t in_between(enum square sq1, enum square sq2);
-static void gen_in_between_sq_mask(void);
-static void gen_knight_mask(void);
-static void set_dest_sq_if_valid(enum rank rank, enum file file, uint64_t *bb);
-static void gen_king_mask(void);
-static void occ_mask_gen_diagonal_occupancy_masks(void);
-static void gen_queen_mask(void);
-static void gen_rook_mask(void);
-
 //
 //
 // NOTES :
 //              - For these occupancy masks, element [0] is a1, and [63] is h8
 //              - The bit mask represents the set of possible target squares for a piece on a given square
+//              - The tables are generated offline by tools/table_gen.py (see occupancy_mask_tables.h),
+//                so there's nothing to build at runtime
 //
 // clang-format off
-static uint64_t in_between_sq[NUM_SQUARES][NUM_SQUARES] = {{0}, {0}};
-static uint64_t knight_occupancy_masks[NUM_SQUARES]     = {0};
-static uint64_t king_occupancy_masks[NUM_SQUARES]       = {0};
-static struct diagonals diagonal_masks[NUM_SQUARES]     = {0};
-static uint64_t queen_occupancy_masks[NUM_SQUARES]      = {0};
-static uint64_t rook_occupancy_masks[NUM_SQUARES]       = {0};
-
 
 // WHITE double pawn masks
 #define FILE_A_WHITE_DOUBLE_PAWN_MASK       ((uint64_t)(SQUARE_AS_BITBOARD(a3) | SQUARE_AS_BITBOARD(a4)))
@@ -72,16 +59,6 @@ static uint64_t rook_occupancy_masks[NUM_SQUARES]       = {0};
 
 // clang-format on
 
-void occ_mask_init(void) {
-    gen_in_between_sq_mask();
-    gen_knight_mask();
-    gen_king_mask();
-    occ_mask_gen_diagonal_occupancy_masks();
-
-    gen_rook_mask();
-    gen_queen_mask();
-}
-
 uint64_t occ_mask_get_inbetween(enum square sq1, enum square sq2) {
     assert(validate_square(sq1));
     assert(validate_square(sq2));
@@ -224,249 +201,3 @@ uint64_t occ_mask_get_rook(enum square sq) {
     assert(validate_square(sq));
     return rook_occupancy_masks[sq];
 }
-
-static void gen_in_between_sq_mask(void) {
-    for (enum square i = a1; i <= h8; i++) {
-        for (enum square j = a1; j <= h8; j++) {
-            in_between_sq[i][j] = in_between(i, j);
-        }
-    }
-}
-
-// The code is taken from :
-// https://www.chessprogramming.org/Square_Attacked_By#LegalityTest
-//
-static uint64_t in_between(enum square sq1, enum square sq2) {
-#define M1 0xffffffffffffffff
-#define A2A7 0x0001010101010100
-#define B2G7 0x0040201008040200
-#define H1B7 0x0002040810204080
-
-    const uint64_t btwn = (M1 << sq1) ^ (M1 << sq2);
-    const uint64_t file = (sq2 & 7) - (sq1 & 7);
-    const uint64_t rank = ((sq2 | 7) - sq1) >> 3;
-    uint64_t line = ((file & 7) - 1) & A2A7;   /* a2a7 if same file */
-    line += 2 * (((rank & 7) - 1) >> 58);      /* b1g1 if same rank */
-    line += (((rank - file) & 15) - 1) & B2G7; /* b2g7 if same diagonal */
-    line += (((rank + file) & 15) - 1) & H1B7; /* h1b7 if same antidiag */
-    line *= btwn & -btwn;                      /* mul acts like shift by smaller square */
-
-    return line & btwn; /* return the bits on that line in-between */
-}
-
-static void gen_queen_mask(void) {
-    for (enum square sq = a1; sq <= h8; sq++) {
-        struct diagonals diag_masks = occ_mask_get_diagonals(sq);
-        const uint64_t bishop_mask = diag_masks.positive | diag_masks.negative;
-        const uint64_t rook_mask = occ_mask_get_rook(sq);
-
-        uint64_t queen = bishop_mask | rook_mask;
-        // clear our square
-        bb_clear_square(&queen, sq);
-        queen_occupancy_masks[sq] = queen;
-    }
-}
-
-static void gen_rook_mask(void) {
-    for (enum square sq = a1; sq <= h8; sq++) {
-        const uint64_t horiz_mask = occ_mask_get_horizontal(sq);
-        const uint64_t vert_mask = occ_mask_get_vertical(sq);
-
-        rook_occupancy_masks[sq] = (horiz_mask | vert_mask);
-    }
-}
-
-static void gen_knight_mask(void) {
-
-    for (enum square sq = a1; sq <= h8; sq++) {
-        enum rank dest_rank = 0;
-        enum file dest_file = 0;
-
-        // 8 destination squares are:
-        // (-2 +8), (-1 + 16), (+1 + 16) (+2 + 8),
-        // (-2 -8), (-1 - 16), (+1 - 16) (+2 - 8),
-
-        enum rank rank = sq_get_rank(sq);
-        enum file file = sq_get_file(sq);
-
-        uint64_t b = 0;
-
-        // left 1 file, up 2 ranks
-        dest_rank = rank + 2;
-        dest_file = file - 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // left 1 file, down 2 ranks
-        dest_rank = rank - 2;
-        dest_file = file - 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // left 2 files, up 1 rank
-        dest_rank = rank + 1;
-        dest_file = file - 2;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // left 2 files, down 1 rank
-        dest_rank = rank - 1;
-        dest_file = file - 2;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 1 file, up 2 ranks
-        dest_rank = rank + 2;
-        dest_file = file + 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 1 file, down 2 ranks
-        dest_rank = rank - 2;
-        dest_file = file + 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 2 files, up 1 rank
-        dest_rank = rank + 1;
-        dest_file = file + 2;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 2 files, down 1 rank
-        dest_rank = rank - 1;
-        dest_file = file + 2;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        knight_occupancy_masks[sq] = b;
-    }
-}
-
-static void gen_king_mask(void) {
-    for (enum square sq = a1; sq <= h8; sq++) {
-        // valid king moves, and resulting distance vector
-        // +7, +8, +9
-        // -1,  K, +1
-        // -9, -8, -7
-
-        // the equates to ranks and files as follows (rank/file):
-        //      (+1, -1),       (+1, 0),        (+1, +1)
-        //       (0, -1),       XXX,            (0, +1)
-        // etc
-        enum rank dest_rank = 0;
-        enum file dest_file = 0;
-
-        enum rank rank = sq_get_rank(sq);
-        enum file file = sq_get_file(sq);
-
-        uint64_t b = 0;
-
-        // left 1 file, up 1 rank
-        dest_rank = rank + 1;
-        dest_file = file - 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // no file move, up 1 rank
-        dest_rank = rank + 1;
-        dest_file = file;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 1 file, up 1 rank
-        dest_rank = rank + 1;
-        dest_file = file + 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // left 1 file, no rank change
-        dest_rank = rank;
-        dest_file = file - 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 1 file, no rank change
-        dest_rank = rank;
-        dest_file = file + 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // right 1 file, down 1 rank
-        dest_rank = rank - 1;
-        dest_file = file + 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // no file move, down 1 rank
-        dest_rank = rank - 1;
-        dest_file = file;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        // left 1 file, down 1 rank
-        dest_rank = rank - 1;
-        dest_file = file - 1;
-        set_dest_sq_if_valid(dest_rank, dest_file, &b);
-
-        king_occupancy_masks[sq] = b;
-    }
-}
-
-static void occ_mask_gen_diagonal_occupancy_masks(void) {
-    for (enum square sq = a1; sq <= h8; sq++) {
-
-        enum rank rank = sq_get_rank(sq);
-        enum file file = sq_get_file(sq);
-
-        enum rank dest_rank = 0;
-        enum file dest_file = 0;
-        uint64_t b = 0;
-
-        // move SW
-        dest_rank = rank;
-        dest_file = file;
-        while (sq_is_valid_file(dest_file) && sq_is_valid_rank(dest_rank)) {
-            set_dest_sq_if_valid(dest_rank, dest_file, &b);
-            dest_rank--;
-            dest_file--;
-        }
-        // clear our square
-        bb_clear_square(&b, sq);
-        diagonal_masks[sq].positive |= b;
-
-        // move NW
-        b = 0;
-        dest_rank = rank;
-        dest_file = file;
-        while (sq_is_valid_file(dest_file) && sq_is_valid_rank(dest_rank)) {
-            set_dest_sq_if_valid(dest_rank, dest_file, &b);
-            dest_rank++;
-            dest_file--;
-        }
-        // clear our square
-        bb_clear_square(&b, sq);
-        diagonal_masks[sq].negative |= b;
-
-        // move SE
-        b = 0;
-        dest_rank = rank;
-        dest_file = file;
-        while (sq_is_valid_file(dest_file) && sq_is_valid_rank(dest_rank)) {
-            set_dest_sq_if_valid(dest_rank, dest_file, &b);
-            dest_rank--;
-            dest_file++;
-        }
-        // clear our square
-        bb_clear_square(&b, sq);
-        diagonal_masks[sq].negative |= b;
-
-        // move NE
-        b = 0;
-        dest_rank = rank;
-        dest_file = file;
-        while (sq_is_valid_file(dest_file) && sq_is_valid_rank(dest_rank)) {
-            set_dest_sq_if_valid(dest_rank, dest_file, &b);
-            dest_rank++;
-            dest_file++;
-        }
-        // clear our square
-        bb_clear_square(&b, sq);
-        diagonal_masks[sq].positive |= b;
-    }
-}
-
-static void set_dest_sq_if_valid(enum rank rank, enum file file, uint64_t *bb) {
-    if (sq_is_valid_file(file) && sq_is_valid_rank(rank)) {
-        enum square dest_sq = sq_gen_from_rank_file(rank, file);
-        bb_set_square(bb, (enum square)dest_sq);
-        //printf("---- OK  rank/file (sq=%d): %d/%d\n", dest_sq, rank, file);
-    } else {
-        //printf("XXXX bad rank/file: %d/%d\n", rank, file);
-    }
-}
@@ -27,10 +27,19 @@
 #pragma once
 #include "bitboard.h"
 #include "square.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 // clang-format off
 
+/**
+ * @brief Indexing schemes for the sliding piece attack tables
+ */
+enum slider_attack_backend {
+    SLIDER_BACKEND_MAGIC,
+    SLIDER_BACKEND_PEXT,
+};
+
 struct diagonals {
     uint64_t positive;
     uint64_t negative;
@@ -52,7 +61,6 @@ struct diagonals {
 
 // clang-format on
 
-void occ_mask_init(void);
 uint64_t occ_mask_get_inbetween(enum square sq1, enum square sq2);
 uint64_t occ_mask_get_black_pawn_capture_non_first_double_move(enum square sq);
 uint64_t occ_mask_get_white_pawn_capture_non_first_double_move(enum square sq);
@@ -69,3 +77,12 @@ uint64_t occ_mask_get_double_pawn_mask_white(enum square from_sq);
 uint64_t occ_mask_get_double_pawn_mask_black(enum square from_sq);
 
 struct diagonals occ_mask_get_diagonals(enum square sq);
+
+void occ_mask_init_slider_attacks(void);
+bool occ_mask_is_pext_supported(void);
+bool occ_mask_is_pext_fast(void);
+bool occ_mask_set_slider_backend(enum slider_attack_backend backend);
+enum slider_attack_backend occ_mask_get_slider_backend(void);
+uint64_t occ_mask_get_rook_attacks(enum square sq, uint64_t occupied);
+uint64_t occ_mask_get_bishop_attacks(enum square sq, uint64_t occupied);
+uint64_t occ_mask_get_queen_attacks(enum square sq, uint64_t occupied);
@@ -40,29 +40,8 @@
 #include <assert.h>
 #include <stdint.h>
 
-struct colour_info {
-    uint64_t colour_bb;
-    uint64_t piece_bb[NUM_PIECE_ROLES];
-    Score material;
-    enum square king_sq;
-};
-
-/**
- * @brief struct for containing the board
- * 
- */
-struct board {
-    struct colour_info colour_info[NUM_COLOURS];
-
-    // contains the piece on a given square
-    enum piece pce_square[NUM_SQUARES];
-
-    uint32_t init_flag;
-};
-
 static bool validate_square_empty(const struct board *const brd, enum square to_sq);
 static bool validate_pce_on_sq(const struct board *const brd, enum piece pce, enum square sq);
-static void init_struct(struct board *brd);
 
 static const uint32_t INIT_KEY = 0xDEADBEEF;
 
@@ -78,11 +57,40 @@ static const uint32_t INIT_KEY = 0xDEADBEEF;
  */
 struct board *brd_allocate(void) {
     struct board *retval = (struct board *)calloc(1, sizeof(struct board));
-    init_struct(retval);
+    brd_initialise(retval);
 
     return retval;
 }
 
+/**
+ * @brief       Initialises a board in place, leaving it empty
+ * @details     For boards that are embedded in other structs rather than allocated with brd_allocate()
+ *
+ * @param brd   The board to initialise
+ */
+void brd_initialise(struct board *const brd) {
+    memset(brd, 0, sizeof(struct board));
+
+    for (enum square sq = a1; sq <= h8; sq++) {
+        brd->pce_square[sq] = NO_PIECE;
+    }
+
+    brd->init_flag = INIT_KEY;
+}
+
+/**
+ * @brief       Copies the contents of one board into another
+ * @details     The board holds no pointers, so a flat copy is a complete snapshot
+ *
+ * @param src   The board to copy from
+ * @param dst   The board to copy into
+ */
+void brd_copy(const struct board *const src, struct board *const dst) {
+    assert(validate_board(src));
+
+    memcpy(dst, src, sizeof(struct board));
+}
+
 /**
  * @brief De-allocated the board
  * 
@@ -424,16 +432,6 @@ void brd_print(const struct board *const brd) {
 //
 // ==================================================================
 
-static void init_struct(struct board *const brd) {
-    memset(brd, 0, sizeof(struct board));
-
-    for (enum square sq = a1; sq <= h8; sq++) {
-        brd->pce_square[sq] = NO_PIECE;
-    }
-
-    brd->init_flag = INIT_KEY;
-}
-
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
 
@@ -39,7 +39,26 @@ struct material {
     Score black;
 };
 
-struct board;
+struct colour_info {
+    uint64_t colour_bb;
+    uint64_t piece_bb[NUM_PIECE_ROLES];
+    Score material;
+    enum square king_sq;
+};
+
+/**
+ * @brief struct for containing the board
+ * @details Only holds values, never pointers, so a board can be copied with memcpy. Use the brd_ functions
+ *          rather than accessing the fields directly.
+ */
+struct board {
+    struct colour_info colour_info[NUM_COLOURS];
+
+    // contains the piece on a given square
+    enum piece pce_square[NUM_SQUARES];
+
+    uint32_t init_flag;
+};
 
 void brd_deallocate(struct board *const brd);
 bool validate_board(const struct board *const brd);
@@ -58,6 +77,7 @@ uint64_t brd_get_colour_bb(const struct board *const brd, enum colour colour);
 uint64_t brd_get_bb_for_role_colour(const struct board *const brd, enum piece_role role, enum colour colour);
 
 bool brd_compare(const struct board *const first, const struct board *const second);
+void brd_copy(const struct board *const src, struct board *const dst);
 void brd_print(const struct board *const brd);
 
 enum square brd_get_king_square(const struct board *const brd, enum colour colour);
@@ -65,3 +85,4 @@ enum square brd_get_king_square(const struct board *const brd, enum colour colou
 bool brd_try_get_piece_on_square(const struct board *const brd, enum square sq, enum piece *piece);
 struct material brd_get_material(const struct board *const brd);
 struct board *brd_allocate(void);
+void brd_initialise(struct board *const brd);
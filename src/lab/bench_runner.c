@@ -28,11 +28,14 @@
 #include "move.h"
 #include "move_gen.h"
 #include "move_list.h"
+#include "move_stack.h"
+#include "occupancy_mask.h"
 #include "perft.h"
 #include "piece.h"
 #include "position.h"
 #include "search.h"
 #include "square.h"
+#include "transposition_table.h"
 #include "utils.h"
 
 #include <inttypes.h>
@@ -45,11 +48,36 @@
 #define NUM_LOOPS (100 * MILLION)
 #define NUM_TESTS 20
 
+// positions and depth used to compare the slider attack backends
+#define SLIDER_BENCH_DEPTH 5
+// make/unmake vs copy-make makes every leaf move, so use a shallower depth
+#define MAKE_MODE_BENCH_DEPTH 4
+
+#define TT_BENCH_SIZE_IN_BYTES ((uint64_t)1024 * 1024 * 1024)
+#define SLIDER_BENCH_NUM_FENS 3
+static const char *SLIDER_BENCH_FENS[SLIDER_BENCH_NUM_FENS] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+};
+
 static uint64_t first(void);
 static uint64_t second(void);
+static void compare_slider_backends(void);
+static uint64_t perft_slider_backend(const char *backend_name);
+static void compare_make_modes(void);
+static uint64_t perft_make_unmake(const uint8_t depth, struct position *pos, struct move_stack *const mvs);
+static uint64_t perft_copy_make(const uint8_t depth, struct position *const pos, struct pos_snapshot *const snaps,
+                                struct move_stack *const mvs);
+static void print_make_mode_result(const char *mode_name, uint64_t nodes, double elapsed_in_secs);
+static void report_tt_allocation(void);
 
 int main(void) {
 
+    compare_slider_backends();
+    compare_make_modes();
+    report_tt_allocation();
+
     uint64_t accum_1 = 0;
     uint64_t accum_2 = 0;
 
@@ -99,3 +127,151 @@ static uint64_t second(void) {
 
     return bb;
 }
+
+static void compare_slider_backends(void) {
+    occ_mask_init_slider_attacks();
+
+    const enum slider_attack_backend default_backend = occ_mask_get_slider_backend();
+    if (default_backend == SLIDER_BACKEND_PEXT) {
+        printf("Slider backend chosen : pext\n");
+    } else if (occ_mask_is_pext_supported()) {
+        printf("Slider backend chosen : magic (pext is supported but microcoded on this CPU)\n");
+    } else {
+        printf("Slider backend chosen : magic\n");
+    }
+
+    occ_mask_set_slider_backend(SLIDER_BACKEND_MAGIC);
+    const uint64_t magic_nodes = perft_slider_backend("magic");
+
+    if (occ_mask_set_slider_backend(SLIDER_BACKEND_PEXT)) {
+        const uint64_t pext_nodes = perft_slider_backend("pext");
+        if (magic_nodes != pext_nodes) {
+            print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "node counts should be the same");
+        }
+    } else {
+        printf("Slider backend pext : not supported on this CPU\n");
+    }
+
+    occ_mask_set_slider_backend(default_backend);
+}
+
+static uint64_t perft_slider_backend(const char *backend_name) {
+    uint64_t total_nodes = 0;
+
+    const double start_in_secs = get_time_of_day_in_secs();
+    for (int i = 0; i < SLIDER_BENCH_NUM_FENS; i++) {
+        struct position *pos = pos_create();
+        pos_initialise(SLIDER_BENCH_FENS[i], pos);
+        total_nodes += do_perft(SLIDER_BENCH_DEPTH, pos);
+        pos_destroy(pos);
+    }
+    const double elapsed_in_secs = get_elapsed_time_in_secs(start_in_secs);
+
+    const double nodes_per_sec = elapsed_in_secs > 0 ? (double)total_nodes / elapsed_in_secs : 0;
+    printf("Slider backend %-5s : #nodes=%" PRIu64 ", time=%lfs, #nodes/sec=%f\n", backend_name, total_nodes,
+           elapsed_in_secs, nodes_per_sec);
+    return total_nodes;
+}
+
+static void compare_make_modes(void) {
+    uint64_t unmake_nodes = 0;
+    uint64_t copy_nodes = 0;
+    double unmake_secs = 0;
+    double copy_secs = 0;
+
+    struct move_stack *mvs = mvs_create();
+
+    // one snapshot per ply for copy-make, index 0 is the root
+    struct pos_snapshot snaps[MAKE_MODE_BENCH_DEPTH + 1];
+    // runs the move generator on whichever snapshot is being expanded
+    struct position *snap_pos = pos_create();
+
+    for (int i = 0; i < SLIDER_BENCH_NUM_FENS; i++) {
+        struct position *pos = pos_create();
+        pos_initialise(SLIDER_BENCH_FENS[i], pos);
+
+        double start_in_secs = get_time_of_day_in_secs();
+        unmake_nodes += perft_make_unmake(MAKE_MODE_BENCH_DEPTH, pos, mvs);
+        unmake_secs += get_elapsed_time_in_secs(start_in_secs);
+
+        pos_save_snapshot(pos, &snaps[0]);
+
+        start_in_secs = get_time_of_day_in_secs();
+        copy_nodes += perft_copy_make(MAKE_MODE_BENCH_DEPTH, snap_pos, snaps, mvs);
+        copy_secs += get_elapsed_time_in_secs(start_in_secs);
+
+        pos_destroy(pos);
+    }
+
+    pos_destroy(snap_pos);
+    mvs_destroy(mvs);
+
+    if (unmake_nodes != copy_nodes) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "node counts should be the same");
+    }
+
+    print_make_mode_result("make/unmake", unmake_nodes, unmake_secs);
+    print_make_mode_result("copy-make", copy_nodes, copy_secs);
+}
+
+static uint64_t perft_make_unmake(const uint8_t depth, struct position *pos, struct move_stack *const mvs) {
+    if (depth == 0) {
+        return 1;
+    }
+
+    uint64_t nodes = 0;
+    struct move_list *const mvl = mvs_push(mvs);
+
+    mv_gen_legal_moves(pos, mvl);
+
+    for (int i = 0; i < mvl->move_count; i++) {
+        pos_make_legal_move(pos, mvl->move_list[i]);
+        nodes += perft_make_unmake((uint8_t)(depth - 1), pos, mvs);
+        pos_take_move(pos);
+    }
+
+    mvs_pop(mvs);
+    return nodes;
+}
+
+static uint64_t perft_copy_make(const uint8_t depth, struct position *const pos, struct pos_snapshot *const snaps,
+                                struct move_stack *const mvs) {
+    if (depth == 0) {
+        return 1;
+    }
+
+    uint64_t nodes = 0;
+    struct move_list *const mvl = mvs_push(mvs);
+
+    pos_attach_snapshot(pos, &snaps[0]);
+    mv_gen_legal_moves(pos, mvl);
+
+    for (int i = 0; i < mvl->move_count; i++) {
+        pos_make_move_copy(&snaps[0], &snaps[1], mvl->move_list[i]);
+        nodes += perft_copy_make((uint8_t)(depth - 1), pos, snaps + 1, mvs);
+    }
+
+    mvs_pop(mvs);
+    return nodes;
+}
+
+static void print_make_mode_result(const char *mode_name, uint64_t nodes, double elapsed_in_secs) {
+    const double nodes_per_sec = elapsed_in_secs > 0 ? (double)nodes / elapsed_in_secs : 0;
+    printf("Make mode %-11s : #nodes=%" PRIu64 ", time=%lfs, #nodes/sec=%f\n", mode_name, nodes, elapsed_in_secs,
+           nodes_per_sec);
+}
+
+static void report_tt_allocation(void) {
+    double start_in_secs = get_time_of_day_in_secs();
+    tt_create(TT_BENCH_SIZE_IN_BYTES);
+    const double create_secs = get_elapsed_time_in_secs(start_in_secs);
+
+    start_in_secs = get_time_of_day_in_secs();
+    tt_resize(TT_BENCH_SIZE_IN_BYTES);
+    const double clear_secs = get_elapsed_time_in_secs(start_in_secs);
+
+    printf("TT size=%" PRIu64 " bytes, page size=%zu bytes, create time=%lfs, clear time=%lfs\n",
+           TT_BENCH_SIZE_IN_BYTES, tt_page_size(), create_secs, clear_secs);
+
+    tt_dispose();
+}
@@ -41,9 +41,26 @@
  *
  */
 
-enum move_flag_bits { MV_FLG_BIT_PROMOTE = 0x80, MV_FLG_BIT_CAPTURE = 0x40 };
+// clang-format off
+// bit layout of the packed move :
+//      bits 0-5    from square
+//      bits 6-11   to square
+//      bits 12-15  move type (the high nibble of enum move_type)
+#define MV_SHIFT_TO_SQ          (6)
+#define MV_SHIFT_TYPE_NIBBLE    (8)
+
+#define MV_MASK_FROM_SQ         ((uint16_t)0x003F)
+#define MV_MASK_TO_SQ           ((uint16_t)0x0FC0)
+#define MV_MASK_TYPE            ((uint16_t)0xF000)
+
+enum move_flag_bits { 
+    MV_FLG_BIT_PROMOTE = 0x8000, 
+    MV_FLG_BIT_CAPTURE = 0x4000 
+};
+// clang-format on
 
 static const char *move_details(const struct move mv);
+static inline struct move encode_move(enum square from_sq, enum square to_sq, enum move_type mv_type);
 
 // ==================================================================
 //
@@ -58,7 +75,7 @@ static const char *move_details(const struct move mv);
  * @return enum move_type The move type 
  */
 enum move_type move_get_move_type(struct move mv) {
-    return mv.move_type;
+    return (enum move_type)((mv.bitmap & MV_MASK_TYPE) >> MV_SHIFT_TYPE_NIBBLE);
 }
 
 /**
@@ -73,7 +90,7 @@ struct move move_encode_quiet(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_QUIET};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_QUIET);
     return mv;
 }
 
@@ -88,7 +105,7 @@ struct move move_encode_promote_knight(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_KNIGHT};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_KNIGHT);
     return mv;
 }
 
@@ -103,7 +120,7 @@ struct move move_encode_promote_knight_with_capture(enum square from_sq, enum sq
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_KNIGHT_CAPTURE};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_KNIGHT_CAPTURE);
     return mv;
 }
 
@@ -118,7 +135,7 @@ struct move move_encode_promote_bishop(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_BISHOP};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_BISHOP);
     return mv;
 }
 
@@ -133,7 +150,7 @@ struct move move_encode_promote_bishop_with_capture(enum square from_sq, enum sq
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_BISHOP_CAPTURE};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_BISHOP_CAPTURE);
     return mv;
 }
 
@@ -148,7 +165,7 @@ struct move move_encode_promote_rook(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_ROOK};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_ROOK);
     return mv;
 }
 
@@ -163,7 +180,7 @@ struct move move_encode_promote_rook_with_capture(enum square from_sq, enum squa
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_ROOK_CAPTURE};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_ROOK_CAPTURE);
     return mv;
 }
 
@@ -178,7 +195,7 @@ struct move move_encode_promote_queen(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_QUEEN};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_QUEEN);
     return mv;
 }
 
@@ -193,7 +210,7 @@ struct move move_encode_promote_queen_with_capture(enum square from_sq, enum squ
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_PROMOTE_QUEEN_CAPTURE};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_PROMOTE_QUEEN_CAPTURE);
     return mv;
 }
 
@@ -208,7 +225,7 @@ struct move move_encode_capture(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_CAPTURE};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_CAPTURE);
     return mv;
 }
 
@@ -218,7 +235,7 @@ struct move move_encode_capture(enum square from_sq, enum square to_sq) {
  * @return      The encoded move
  */
 struct move move_encode_castle_kingside_white(void) {
-    struct move mv = {.from_sq = e1, .to_sq = g1, .move_type = MV_TYPE_KING_CASTLE};
+    const struct move mv = encode_move(e1, g1, MV_TYPE_KING_CASTLE);
     return mv;
 }
 
@@ -228,7 +245,7 @@ struct move move_encode_castle_kingside_white(void) {
  * @return      The encoded move
  */
 struct move move_encode_castle_kingside_black(void) {
-    struct move mv = {.from_sq = e8, .to_sq = g8, .move_type = MV_TYPE_KING_CASTLE};
+    const struct move mv = encode_move(e8, g8, MV_TYPE_KING_CASTLE);
     return mv;
 }
 
@@ -238,7 +255,7 @@ struct move move_encode_castle_kingside_black(void) {
  * @return      The encoded move
  */
 struct move move_encode_castle_queenside_white(void) {
-    struct move mv = {.from_sq = e1, .to_sq = c1, .move_type = MV_TYPE_QUEEN_CASTLE};
+    const struct move mv = encode_move(e1, c1, MV_TYPE_QUEEN_CASTLE);
     return mv;
 }
 
@@ -248,7 +265,7 @@ struct move move_encode_castle_queenside_white(void) {
  * @return      The encoded move
  */
 struct move move_encode_castle_queenside_black(void) {
-    struct move mv = {.from_sq = e8, .to_sq = c8, .move_type = MV_TYPE_QUEEN_CASTLE};
+    const struct move mv = encode_move(e8, c8, MV_TYPE_QUEEN_CASTLE);
     return mv;
 }
 
@@ -262,7 +279,7 @@ struct move move_encode_pawn_double_first(enum square from_sq, enum square to_sq
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_DOUBLE_PAWN};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_DOUBLE_PAWN);
     return mv;
 }
 
@@ -277,7 +294,7 @@ struct move move_encode_enpassant(enum square from_sq, enum square to_sq) {
     assert(validate_square(from_sq));
     assert(validate_square(to_sq));
 
-    struct move mv = {.from_sq = from_sq, .to_sq = to_sq, .move_type = MV_TYPE_EN_PASS};
+    const struct move mv = encode_move(from_sq, to_sq, MV_TYPE_EN_PASS);
     return mv;
 }
 
@@ -288,7 +305,7 @@ struct move move_encode_enpassant(enum square from_sq, enum square to_sq) {
  * @return The from square
  */
 enum square move_decode_from_sq(struct move mv) {
-    return mv.from_sq;
+    return (enum square)(mv.bitmap & MV_MASK_FROM_SQ);
 }
 
 /**
@@ -298,7 +315,7 @@ enum square move_decode_from_sq(struct move mv) {
  * @return The to square
  */
 enum square move_decode_to_sq(struct move mv) {
-    return mv.to_sq;
+    return (enum square)((mv.bitmap & MV_MASK_TO_SQ) >> MV_SHIFT_TO_SQ);
 }
 
 /**
@@ -308,7 +325,7 @@ enum square move_decode_to_sq(struct move mv) {
  * @return      true if quiet, false otherwise
  */
 bool move_is_quiet(const struct move mv) {
-    return mv.move_type == MV_TYPE_QUIET;
+    return move_get_move_type(mv) == MV_TYPE_QUIET;
 }
 
 /**
@@ -318,7 +335,7 @@ bool move_is_quiet(const struct move mv) {
  * @return      true if double pawn move, false otherwise
  */
 bool move_is_double_pawn(struct move mv) {
-    return mv.move_type == MV_TYPE_DOUBLE_PAWN;
+    return move_get_move_type(mv) == MV_TYPE_DOUBLE_PAWN;
 }
 
 /**
@@ -328,7 +345,7 @@ bool move_is_double_pawn(struct move mv) {
  * @return      true if king-side castle move, false otherwise
  */
 bool move_is_king_castle(struct move mv) {
-    return mv.move_type == MV_TYPE_KING_CASTLE;
+    return move_get_move_type(mv) == MV_TYPE_KING_CASTLE;
 }
 
 /**
@@ -338,7 +355,7 @@ bool move_is_king_castle(struct move mv) {
  * @return      true if queen-side castle move, false otherwise
  */
 bool move_is_queen_castle(struct move mv) {
-    return mv.move_type == MV_TYPE_QUEEN_CASTLE;
+    return move_get_move_type(mv) == MV_TYPE_QUEEN_CASTLE;
 }
 
 /**
@@ -349,7 +366,7 @@ bool move_is_queen_castle(struct move mv) {
  * @return     The move type enum{ description_of_the_return_value }
  */
 enum move_type move_get_type(struct move mv) {
-    return mv.move_type;
+    return (enum move_type)((mv.bitmap & MV_MASK_TYPE) >> MV_SHIFT_TYPE_NIBBLE);
 }
 
 /**
@@ -362,7 +379,7 @@ enum move_type move_get_type(struct move mv) {
 bool move_is_capture(struct move mv) {
     assert(validate_move(mv));
 
-    return (mv.move_type & MV_FLG_BIT_CAPTURE) != 0;
+    return (mv.bitmap & MV_FLG_BIT_CAPTURE) != 0;
 }
 
 /**
@@ -375,7 +392,7 @@ bool move_is_capture(struct move mv) {
 bool move_is_promotion(struct move mv) {
     assert(validate_move(mv));
 
-    return (mv.move_type & MV_FLG_BIT_PROMOTE) != 0;
+    return (mv.bitmap & MV_FLG_BIT_PROMOTE) != 0;
 }
 
 /**
@@ -388,7 +405,7 @@ bool move_is_promotion(struct move mv) {
 bool move_is_en_passant(struct move mv) {
     assert(validate_move(mv));
 
-    return mv.move_type == MV_TYPE_EN_PASS;
+    return move_get_move_type(mv) == MV_TYPE_EN_PASS;
 }
 
 /**
@@ -404,6 +421,17 @@ bool move_is_castle(struct move mv) {
     return move_is_king_castle(mv) || move_is_queen_castle(mv);
 }
 
+/**
+ * @brief       Returns a move used to represent "no move" (eg, an empty TT or killer slot)
+ * @details     The move is a1 to a1, which is never generated.
+ *
+ * @return The "no move" move
+ */
+struct move move_get_no_move(void) {
+    const struct move mv = encode_move(a1, a1, MV_TYPE_QUIET);
+    return mv;
+}
+
 /**
  * @brief       Compares 2 moves for equality
  *
@@ -415,7 +443,7 @@ bool move_compare(struct move mv1, struct move mv2) {
     assert(validate_move(mv1));
     assert(validate_move(mv2));
 
-    return mv1.from_sq == mv2.from_sq && mv1.to_sq == mv2.to_sq && mv1.move_type == mv2.move_type;
+    return mv1.bitmap == mv2.bitmap;
 }
 
 /**
@@ -444,6 +472,13 @@ char *move_print(struct move mv) {
     return move_string;
 }
 
+static inline struct move encode_move(enum square from_sq, enum square to_sq, enum move_type mv_type) {
+    const struct move mv = {
+        .bitmap = (uint16_t)((uint16_t)from_sq | ((uint16_t)to_sq << MV_SHIFT_TO_SQ) |
+                             ((uint16_t)mv_type << MV_SHIFT_TYPE_NIBBLE))};
+    return mv;
+}
+
 const char *move_details(struct move mv) {
 
     const enum move_type mt = move_get_type(mv);
@@ -484,11 +519,11 @@ const char *move_details(struct move mv) {
 
 bool validate_move(struct move mv) {
 
-    const bool from_ok = validate_square(mv.from_sq);
-    const bool to_ok = validate_square(mv.to_sq);
+    const bool from_ok = validate_square(move_decode_from_sq(mv));
+    const bool to_ok = validate_square(move_decode_to_sq(mv));
 
     bool move_type_ok = false;
-    switch (mv.move_type) {
+    switch (move_get_move_type(mv)) {
     case MV_TYPE_QUIET:
     case MV_TYPE_DOUBLE_PAWN:
     case MV_TYPE_KING_CASTLE:
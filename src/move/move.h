@@ -72,10 +72,10 @@ enum move_type {
 };
 
 
+// A move packed into 16 bits : from square (6 bits), to square (6 bits) and the move type
+// as above (4 bits). Use the move_encode_* and move_decode_* functions to access.
 struct move {
-    enum square from_sq;
-    enum square to_sq;
-    enum move_type move_type;
+    uint16_t bitmap;
 };
 
 // clang-format on
@@ -50,34 +50,91 @@
 #define CASTLE_SQ_MASK_WQ ((uint64_t)(SQUARE_AS_BITBOARD(b1) | SQUARE_AS_BITBOARD(c1) | SQUARE_AS_BITBOARD(d1)))
 #define CASTLE_SQ_MASK_BK ((uint64_t)(SQUARE_AS_BITBOARD(f8) | SQUARE_AS_BITBOARD(g8)))
 #define CASTLE_SQ_MASK_BQ ((uint64_t)(SQUARE_AS_BITBOARD(b8) | SQUARE_AS_BITBOARD(c8) | SQUARE_AS_BITBOARD(d8)))
+
+// squares the King crosses when castling Queen-side (King-side, it's the same as the castle mask)
+#define CASTLE_KING_PATH_WQ ((uint64_t)(SQUARE_AS_BITBOARD(c1) | SQUARE_AS_BITBOARD(d1)))
+#define CASTLE_KING_PATH_BQ ((uint64_t)(SQUARE_AS_BITBOARD(c8) | SQUARE_AS_BITBOARD(d8)))
+
+#define ALL_SQUARES_BB (~(uint64_t)0)
+
+// rank bitboards used for set-wise pawn move generation
+#define RANK_2_BB ((uint64_t)(RANK_MASK << (8 * RANK_2)))
+#define RANK_3_BB ((uint64_t)(RANK_MASK << (8 * RANK_3)))
+#define RANK_6_BB ((uint64_t)(RANK_MASK << (8 * RANK_6)))
+#define RANK_7_BB ((uint64_t)(RANK_MASK << (8 * RANK_7)))
 // clang-format on
 
 enum move_gen_type {
     ALL_MOVES,
     CAPTURE_ONLY,
+    QUIET_ONLY,
+};
+
+// Check and pin state for the side to move, calculated once per position and used
+// to filter pseudo-legal moves down to legal moves without having to make them
+struct legal_move_masks {
+    enum square king_sq;
+    // opposing pieces giving check
+    uint64_t checkers;
+    // squares a non-King move must land on (capture the checker or block the check)
+    uint64_t check_evasion;
+    // squares attacked by the opposing side, as seen with our King removed from the board
+    uint64_t king_danger;
+    // our pieces pinned against our King
+    uint64_t pinned;
+    // for each pinned piece, the squares on the pin ray it can move to (including the pinner)
+    uint64_t pin_ray[NUM_SQUARES];
+};
+
+// destination squares for captures and for quiet moves. If a move type isn't being generated, its
+// mask is empty
+struct move_targets {
+    uint64_t capture;
+    uint64_t quiet;
 };
 
-static void mv_gen_white_pawn_moves(const struct position *const pos, struct move_list *const mvl,
-                                    enum move_gen_type gen_type, uint64_t all_pce_bb);
-static void mv_gen_black_pawn_moves(const struct position *const pos, struct move_list *const mvl,
-                                    enum move_gen_type gen_type, uint64_t all_pce_bb);
-static void get_sliding_rank_file_moves(const struct position *const pos, struct move_list *const mvl,
-                                        enum move_gen_type gen_type);
-static void get_sliding_diagonal_antidiagonal_moves(const struct position *const pos, struct move_list *const mvl,
-                                                    enum move_gen_type gen_type);
+// state shared by the quiet check generation for each slider type
+struct slider_check_masks {
+    uint64_t occupied;
+    // our pieces blocking a line between one of our sliders and the opposing King
+    uint64_t discoverers;
+    // for each discoverer, the squares between the opposing King and our slider
+    const uint64_t *blocker_line;
+};
+
+static uint32_t count_bits(uint64_t bb);
 static void gen_promotions(enum square from_sq, enum square to_sq, struct move_list *const mvl);
 static void gen_promotions_with_capture(enum square from_sq, enum square to_sq, struct move_list *const mvl);
-static void mv_gen_knight_moves(const struct position *const pos, struct move_list *const mvl,
-                                enum move_gen_type gen_type);
-static void mv_gen_king_moves(const struct position *const pos, struct move_list *const mvl,
-                              enum move_gen_type gen_type);
 static void mv_gen_encode_multiple_capture(uint64_t bb, enum square from_sq, struct move_list *const mvl);
 static void mv_gen_encode_multiple_quiet(uint64_t bb, enum square from_sq, struct move_list *const mvl);
-static void mv_gen_white_castle_moves(struct move_list *const mvl, struct cast_perm_container castle_perms,
-                                      uint64_t all_pce_bb);
-static void mv_gen_black_castle_moves(struct move_list *const mvl, struct cast_perm_container castle_perms,
-                                      uint64_t all_pce_bb);
+static void mv_gen_encode_pawn_quiet(uint64_t to_bb, int sq_delta, bool is_double, struct move_list *const mvl);
+static void mv_gen_encode_pawn_captures(uint64_t to_bb, int sq_delta, struct move_list *const mvl);
+static void mv_gen_encode_pawn_promotions(uint64_t to_bb, int sq_delta, bool is_capture, struct move_list *const mvl);
 static void mv_gen_moves(const struct position *const pos, struct move_list *const mvl, enum move_gen_type gen_type);
+static void mv_gen_evasions(const struct position *const pos, struct move_list *const mvl,
+                            const struct legal_move_masks *const masks);
+static struct move_targets get_move_targets(const struct board *const brd, enum colour opposing_colour,
+                                            enum move_gen_type gen_type, uint64_t target_bb);
+static void mv_gen_slider_quiet_checks(uint64_t slider_bb, bool is_diagonal, bool is_orthogonal, uint64_t check_bb,
+                                       const struct slider_check_masks *const masks, struct move_list *const mvl);
+static uint64_t get_discovered_check_blockers(const struct board *const brd, enum colour side_to_move,
+                                              enum square opp_king_sq, uint64_t *const blocker_line);
+static void init_check_masks(const struct position *const pos, struct legal_move_masks *const masks);
+static void init_legal_move_masks(const struct position *const pos, struct legal_move_masks *const masks);
+static uint64_t get_attacked_squares(const struct board *const brd, enum colour attacking_side, uint64_t occupied);
+static bool is_legal_move(const struct position *const pos, const struct legal_move_masks *const masks,
+                          struct move mv);
+static bool is_en_passant_legal(const struct position *const pos, const struct legal_move_masks *const masks,
+                                enum square from_sq, enum square to_sq);
+
+// colour-specialised generators, instantiated once for each colour
+#define GEN_IS_WHITE 1
+#define GEN_FN(name) name##_white
+#include "move_gen_colour.h"
+
+#define GEN_IS_WHITE 0
+#define GEN_FN(name) name##_black
+#include "move_gen_colour.h"
 
 /**
  * @brief       Generates only capture moves from the given position
@@ -94,380 +151,193 @@ void mv_gen_only_capture_moves(const struct position *const pos, struct move_lis
 }
 
 /**
- * @brief       Generates all valid moves for the given position
- * @details     Appends all new moves to the given move list
+ * @brief       Generates only non-capture moves from the given position
+ * @details     Appends all new moves to the given move list. Includes castling, double pawn moves
+ *              and non-capture promotions.
  * @param pos   The position
  * @param mvl   The move list
  */
-void mv_gen_all_moves(const struct position *const pos, struct move_list *const mvl) {
+void mv_gen_quiet_moves(const struct position *const pos, struct move_list *const mvl) {
     assert(validate_position(pos));
     assert(validate_move_list(mvl));
 
-    mv_gen_moves(pos, mvl, ALL_MOVES);
+    mv_gen_moves(pos, mvl, QUIET_ONLY);
 }
 
-static void mv_gen_moves(const struct position *const pos, struct move_list *const mvl, enum move_gen_type gen_type) {
-
-    const struct board *const brd = pos_get_board(pos);
-    const struct cast_perm_container castle_perms = pos_get_cast_perm(pos);
-    const uint64_t all_pce_bb = brd_get_board_bb(brd);
+/**
+ * @brief       Generates only non-capture moves that give check
+ * @details     Appends all new moves to the given move list. Includes direct checks (moving a piece
+ *              to a square that attacks the opposing King) and discovered checks (moving a piece off
+ *              the line between one of our sliders and the opposing King). Promotions and castling
+ *              are not included. Moves are pseudo-legal.
+ * @param pos   The position
+ * @param mvl   The move list
+ */
+void mv_gen_quiet_check_moves(const struct position *const pos, struct move_list *const mvl) {
+    assert(validate_position(pos));
+    assert(validate_move_list(mvl));
 
     switch (pos_get_side_to_move(pos)) {
-    case WHITE: {
-        if (cast_perm_has_white_permissions(castle_perms) && (gen_type == ALL_MOVES)) {
-            mv_gen_white_castle_moves(mvl, castle_perms, all_pce_bb);
-        }
-
-        mv_gen_white_pawn_moves(pos, mvl, gen_type, all_pce_bb);
-    } break;
-
-    case BLACK: {
-        if (cast_perm_has_black_permissions(castle_perms) && (gen_type == ALL_MOVES)) {
-            mv_gen_black_castle_moves(mvl, castle_perms, all_pce_bb);
-        }
-
-        mv_gen_black_pawn_moves(pos, mvl, gen_type, all_pce_bb);
-    } break;
+    case WHITE:
+        mv_gen_quiet_checks_white(pos, mvl);
+        break;
+    case BLACK:
+        mv_gen_quiet_checks_black(pos, mvl);
+        break;
     default:
         break;
     }
-
-    // common move code
-    mv_gen_king_moves(pos, mvl, gen_type);
-    mv_gen_knight_moves(pos, mvl, gen_type);
-    get_sliding_diagonal_antidiagonal_moves(pos, mvl, gen_type);
-    get_sliding_rank_file_moves(pos, mvl, gen_type);
 }
 
-static void mv_gen_white_pawn_moves(const struct position *const pos, struct move_list *const mvl,
-                                    enum move_gen_type gen_type, const uint64_t all_pce_bb) {
+/**
+ * @brief       Generates all valid moves for the given position
+ * @details     Appends all new moves to the given move list
+ * @param pos   The position
+ * @param mvl   The move list
+ */
+void mv_gen_all_moves(const struct position *const pos, struct move_list *const mvl) {
     assert(validate_position(pos));
     assert(validate_move_list(mvl));
 
-    const struct board *const brd = pos_get_board(pos);
-
-    uint64_t all_pawns_bb = brd_get_piece_bb(brd, WHITE_PAWN);
-    const uint64_t black_pce_bb = brd_get_colour_bb(brd, BLACK);
-
-    if (pos_is_en_passant_active(pos)) {
-        const enum square en_pass_sq = pos_get_en_pass_sq(pos);
-        const uint64_t att_squares_bb = occ_mask_get_bb_white_pawns_attacking_sq(en_pass_sq);
-        uint64_t att_enp_pawn_bb = all_pawns_bb & att_squares_bb;
-        while (att_enp_pawn_bb != 0) {
-            const enum square from_sq = bb_pop_1st_bit_and_clear(&att_enp_pawn_bb);
-            const struct move en_pass_move = move_encode_enpassant(from_sq, en_pass_sq);
-            mvl_add(mvl, en_pass_move);
-        }
-    }
-
-    while (all_pawns_bb != 0) {
-        const enum square from_sq = bb_pop_1st_bit_and_clear(&all_pawns_bb);
-        const enum rank pawn_rank = sq_get_rank(from_sq);
-
-        switch (pawn_rank) {
-        case RANK_2: {
-            if (gen_type == ALL_MOVES) {
-                // double first move
-                const uint64_t double_bb = occ_mask_get_double_pawn_mask_white(from_sq);
-                if ((double_bb & all_pce_bb) == 0) {
-                    const enum square to_sq = sq_get_square_plus_2_rank(from_sq);
-                    const struct move quiet_move = move_encode_pawn_double_first(from_sq, to_sq);
-                    mvl_add(mvl, quiet_move);
-                }
-
-                // quiet move
-                const enum square to_sq = sq_get_square_plus_1_rank(from_sq);
-                if (bb_is_set(all_pce_bb, to_sq) == false) {
-                    const struct move quiet_move = move_encode_quiet(from_sq, to_sq);
-                    mvl_add(mvl, quiet_move);
-                }
-            }
-
-            // capture moves
-            const uint64_t occ_mask = occ_mask_get_white_pawn_capture_non_first_double_move(from_sq);
-            uint64_t capt_bb = black_pce_bb & occ_mask;
-            while (capt_bb != 0) {
-                const enum square capt_to_sq = bb_pop_1st_bit_and_clear(&capt_bb);
-                const struct move capt_move = move_encode_capture(from_sq, capt_to_sq);
-                mvl_add(mvl, capt_move);
-            }
-        } break;
-        case RANK_7: {
-            // quiet promotion
-            if (gen_type == ALL_MOVES) {
-                const enum square quiet_to_sq = sq_get_square_plus_1_rank(from_sq);
-                if (bb_is_set(all_pce_bb, quiet_to_sq) == false) {
-                    gen_promotions(from_sq, quiet_to_sq, mvl);
-                }
-            }
-
-            // capture promotion
-            const uint64_t occ_mask = occ_mask_get_white_pawn_capture_non_first_double_move(from_sq);
-            uint64_t capt_bb = black_pce_bb & occ_mask;
-            while (capt_bb != 0) {
-                const enum square prom_capt_to_sq = bb_pop_1st_bit_and_clear(&capt_bb);
-                gen_promotions_with_capture(from_sq, prom_capt_to_sq, mvl);
-            }
-        } break;
-        case RANK_3:
-        case RANK_4:
-        case RANK_5:
-        case RANK_6: {
-            // quiet moves
-            if (gen_type == ALL_MOVES) {
-                const enum square to_sq = sq_get_square_plus_1_rank(from_sq);
-                if (bb_is_set(all_pce_bb, to_sq) == false) {
-                    const struct move quiet_move = move_encode_quiet(from_sq, to_sq);
-                    mvl_add(mvl, quiet_move);
-                }
-            }
-
-            // capture moves
-            const uint64_t occ_mask = occ_mask_get_white_pawn_capture_non_first_double_move(from_sq);
-            uint64_t capt_bb = black_pce_bb & occ_mask;
-            while (capt_bb != 0) {
-                const enum square capt_to_sq = bb_pop_1st_bit_and_clear(&capt_bb);
-                const struct move capt_move = move_encode_capture(from_sq, capt_to_sq);
-                mvl_add(mvl, capt_move);
-            }
-        } break;
-        case RANK_1:
-        case RANK_8:
-            break;
-        default:
-            // invalid rank
-            print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Unexpected rank for white");
-            break;
-        } //switch
-    }
+    mv_gen_moves(pos, mvl, ALL_MOVES);
 }
 
-static void mv_gen_black_pawn_moves(const struct position *const pos, struct move_list *const mvl,
-                                    enum move_gen_type gen_type, uint64_t all_pce_bb) {
+/**
+ * @brief       Generates check evasions for the given position
+ * @details     Appends all new moves to the given move list. When in check, only King moves to
+ *              unattacked squares, captures of the checking piece and interpositions are generated.
+ *              Moves by pinned pieces may still be illegal. If the side to move isn't in check, all
+ *              moves are generated.
+ * @param pos   The position
+ * @param mvl   The move list
+ */
+void mv_gen_evasion_moves(const struct position *const pos, struct move_list *const mvl) {
     assert(validate_position(pos));
     assert(validate_move_list(mvl));
 
-    const struct board *const brd = pos_get_board(pos);
+    struct legal_move_masks masks;
+    init_check_masks(pos, &masks);
 
-    uint64_t all_pawns_bb = brd_get_piece_bb(brd, BLACK_PAWN);
-    const uint64_t white_pce_bb = brd_get_colour_bb(brd, WHITE);
-
-    if (pos_is_en_passant_active(pos)) {
-        const enum square en_pass_sq = pos_get_en_pass_sq(pos);
-        const uint64_t att_squares_bb = occ_mask_get_bb_black_pawns_attacking_sq(en_pass_sq);
-        uint64_t att_enp_pawn_bb = all_pawns_bb & att_squares_bb;
-        while (att_enp_pawn_bb != 0) {
-            const enum square from_sq = bb_pop_1st_bit_and_clear(&att_enp_pawn_bb);
-            const struct move en_pass_move = move_encode_enpassant(from_sq, en_pass_sq);
-            mvl_add(mvl, en_pass_move);
-        }
+    if (masks.checkers == 0) {
+        mv_gen_moves(pos, mvl, ALL_MOVES);
+        return;
     }
 
-    while (all_pawns_bb != 0) {
-        const enum square from_sq = bb_pop_1st_bit_and_clear(&all_pawns_bb);
-        const enum rank pawn_rank = sq_get_rank(from_sq);
-
-        switch (pawn_rank) {
-        case RANK_7: {
-            if (gen_type == ALL_MOVES) {
-                // double first move
-                const uint64_t double_bb = occ_mask_get_double_pawn_mask_black(from_sq);
-                if ((double_bb & all_pce_bb) == 0) {
-                    const enum square to_sq = sq_get_square_minus_2_rank(from_sq);
-                    const struct move quiet_move = move_encode_pawn_double_first(from_sq, to_sq);
-                    mvl_add(mvl, quiet_move);
-                }
-
-                // quiet move
-                const enum square to_sq = sq_get_square_minus_1_rank(from_sq);
-                if (bb_is_set(all_pce_bb, to_sq) == false) {
-                    const struct move quiet_move = move_encode_quiet(from_sq, to_sq);
-                    mvl_add(mvl, quiet_move);
-                }
-            }
-
-            // capture moves
-            const uint64_t occ_mask = occ_mask_get_black_pawn_capture_non_first_double_move(from_sq);
-            uint64_t capt_bb = white_pce_bb & occ_mask;
-            while (capt_bb != 0) {
-                const enum square capt_to_sq = bb_pop_1st_bit_and_clear(&capt_bb);
-                const struct move capt_move = move_encode_capture(from_sq, capt_to_sq);
-                mvl_add(mvl, capt_move);
-            }
-        } break;
-        case RANK_2: {
-            // quiet promotion
-            if (gen_type == ALL_MOVES) {
-                const enum square quiet_to_sq = sq_get_square_minus_1_rank(from_sq);
-                if (bb_is_set(all_pce_bb, quiet_to_sq) == false) {
-                    gen_promotions(from_sq, quiet_to_sq, mvl);
-                }
-            }
-
-            // capture promotion
-            const uint64_t occ_mask = occ_mask_get_black_pawn_capture_non_first_double_move(from_sq);
-            uint64_t capt_bb = white_pce_bb & occ_mask;
-            while (capt_bb != 0) {
-                const enum square prom_capt_to_sq = bb_pop_1st_bit_and_clear(&capt_bb);
-                gen_promotions_with_capture(from_sq, prom_capt_to_sq, mvl);
-            }
-        } break;
-        case RANK_3:
-        case RANK_4:
-        case RANK_5:
-        case RANK_6: {
-            // quiet moves
-            if (gen_type == ALL_MOVES) {
-                const enum square to_sq = sq_get_square_minus_1_rank(from_sq);
-                if (bb_is_set(all_pce_bb, to_sq) == false) {
-                    const struct move quiet_move = move_encode_quiet(from_sq, to_sq);
-                    mvl_add(mvl, quiet_move);
-                }
-            }
-
-            // capture moves
-            const uint64_t occ_mask = occ_mask_get_black_pawn_capture_non_first_double_move(from_sq);
-            uint64_t capt_bb = white_pce_bb & occ_mask;
-            while (capt_bb != 0) {
-                const enum square capt_to_sq = bb_pop_1st_bit_and_clear(&capt_bb);
-                const struct move capt_move = move_encode_capture(from_sq, capt_to_sq);
-                mvl_add(mvl, capt_move);
-            }
-        } break;
-        case RANK_1:
-        case RANK_8:
-            break;
-        default:
-            // invalid rank
-            print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Unexpected rank for black");
-            break;
-        } //switch
-    }
+    const struct board *const brd = pos_get_board(pos);
+    const enum colour opposing_colour = pce_swap_side(pos_get_side_to_move(pos));
+    masks.king_danger =
+        get_attacked_squares(brd, opposing_colour, brd_get_board_bb(brd) & ~SQUARE_AS_BITBOARD(masks.king_sq));
+
+    mv_gen_evasions(pos, mvl, &masks);
 }
 
 /**
- * @brief Generate sliding diagonal and antidiagonal moves 
- * 
- * @param pos               The game position
- * @param mvl               The move list
- * @param gen_type          The move type to generate
+ * @brief       Counts the legal moves for the given position
+ * @details     Uses the same check and pin masks as mv_gen_legal_moves(), but counts the target squares
+ *              for each piece rather than encoding each move into a move list.
+ * @param pos   The position
+ * @return      The number of legal moves
  */
-static void get_sliding_diagonal_antidiagonal_moves(const struct position *const pos, struct move_list *const mvl,
-                                                    enum move_gen_type gen_type) {
-
-    assert((gen_type == CAPTURE_ONLY) || (gen_type == ALL_MOVES));
+uint16_t mv_gen_count_legal_moves(const struct position *const pos) {
+    assert(validate_position(pos));
 
-    const struct board *const brd = pos_get_board(pos);
+    struct legal_move_masks masks;
+    init_legal_move_masks(pos, &masks);
 
-    const enum colour side_to_move = pos_get_side_to_move(pos);
-    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
-    const uint64_t colour_bb = brd_get_colour_bb(brd, side_to_move);
-
-    uint64_t pce_to_move_bb =
-        brd_get_bb_for_role_colour(brd, BISHOP, side_to_move) | brd_get_bb_for_role_colour(brd, QUEEN, side_to_move);
-    while (pce_to_move_bb != 0) {
-        const enum square from_sq = bb_pop_1st_bit_and_clear(&pce_to_move_bb);
-
-        const struct diagonals diag_masks = occ_mask_get_diagonals(from_sq);
-
-        // create slider bb for this square
-        const uint64_t bb_slider = SQUARE_AS_BITBOARD(from_sq);
-
-        // diagonal move
-        const uint64_t diag1 = (occupied_sq_bb & diag_masks.positive) - (bb_slider << 1);
-        const uint64_t diag2 =
-            bb_reverse(bb_reverse(occupied_sq_bb & diag_masks.positive) - (bb_reverse(bb_slider) << 1));
-        const uint64_t diagpos = diag1 ^ diag2;
-
-        // anti-diagonal moves
-        const uint64_t antidiag1 = (occupied_sq_bb & diag_masks.negative) - (bb_slider << 1);
-        const uint64_t antidiag2 =
-            bb_reverse(bb_reverse(occupied_sq_bb & diag_masks.negative) - (bb_reverse(bb_slider) << 1));
-        const uint64_t diagneg = antidiag1 ^ antidiag2;
-
-        const uint64_t all_moves = (diagpos & diag_masks.positive) | (diagneg & diag_masks.negative);
-
-        // get all same colour as piece being considered
-        uint64_t excl_same_col = all_moves & ~colour_bb;
-
-        while (excl_same_col != 0) {
-            const enum square to_sq = bb_pop_1st_bit_and_clear(&excl_same_col);
-            if (gen_type == ALL_MOVES) {
-                if (bb_is_set(occupied_sq_bb, to_sq)) {
-                    const struct move mv = move_encode_capture(from_sq, to_sq);
-                    mvl_add(mvl, mv);
-                } else {
-                    const struct move mv = move_encode_quiet(from_sq, to_sq);
-                    mvl_add(mvl, mv);
-                }
-            } else if (bb_is_set(occupied_sq_bb, to_sq)) {
-                const struct move mv = move_encode_capture(from_sq, to_sq);
-                mvl_add(mvl, mv);
-            }
-        }
+    switch (pos_get_side_to_move(pos)) {
+    case WHITE:
+        return mv_gen_count_legal_white(pos, &masks);
+    case BLACK:
+        return mv_gen_count_legal_black(pos, &masks);
+    default:
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid side to move");
+        return 0;
     }
 }
 
 /**
- * @brief Generate sliding RANK and FILE moves 
- * 
- * @param pos               The game position
- * @param mvl               The move list
- * @param gen_type          The move type to generate
+ * @brief       Generates only legal moves for the given position
+ * @details     Appends all new moves to the given move list. Checkers, pinned pieces and the squares
+ *              attacked by the opposing side are calculated once, and used to discard illegal moves
+ *              without the need to make and take each move. When in check, only evasions are
+ *              generated. Any move generated can be made using pos_make_legal_move().
+ * @param pos   The position
+ * @param mvl   The move list
  */
-static void get_sliding_rank_file_moves(const struct position *const pos, struct move_list *const mvl,
-                                        enum move_gen_type gen_type) {
+void mv_gen_legal_moves(const struct position *const pos, struct move_list *const mvl) {
+    assert(validate_position(pos));
+    assert(validate_move_list(mvl));
 
-    // taken from https://www.chessprogramming.org/Hyperbola_Quintessence
+    struct legal_move_masks masks;
+    init_legal_move_masks(pos, &masks);
 
-    const struct board *const brd = pos_get_board(pos);
+    const uint16_t first_new_move = mvl->move_count;
 
-    const enum colour side_to_move = pos_get_side_to_move(pos);
-    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
-    const uint64_t colour_bb = brd_get_colour_bb(brd, side_to_move);
-    const uint64_t reversed_occupied_sq_bb = bb_reverse(occupied_sq_bb);
-
-    uint64_t pce_to_move_bb =
-        brd_get_bb_for_role_colour(brd, ROOK, side_to_move) | brd_get_bb_for_role_colour(brd, QUEEN, side_to_move);
-
-    while (pce_to_move_bb != 0) {
-
-        const enum square from_sq = bb_pop_1st_bit_and_clear(&pce_to_move_bb);
-
-        const uint64_t hmask = occ_mask_get_horizontal(from_sq);
-        const uint64_t vmask = occ_mask_get_vertical(from_sq);
-
-        // create slider bb for this square
-        const uint64_t bb_slider = SQUARE_AS_BITBOARD(from_sq);
-        const uint64_t reverse_bb_slider = bb_reverse(bb_slider);
-
-        const uint64_t horiz1 = occupied_sq_bb - (bb_slider << 1);
-        const uint64_t horiz2 = bb_reverse(reversed_occupied_sq_bb - (reverse_bb_slider << 1));
-        const uint64_t horizontal = horiz1 ^ horiz2;
-
-        const uint64_t vert1 = (occupied_sq_bb & vmask) - (bb_slider << 1);
-        const uint64_t vert2 = bb_reverse(bb_reverse(occupied_sq_bb & vmask) - (reverse_bb_slider << 1));
-        const uint64_t vertical = vert1 ^ vert2;
-
-        const uint64_t all_moves = (horizontal & hmask) | (vertical & vmask);
-
-        uint64_t excl_same_col = all_moves & ~colour_bb;
-        while (excl_same_col != 0) {
-            const enum square to_sq = bb_pop_1st_bit_and_clear(&excl_same_col);
-            if (gen_type == ALL_MOVES) {
-                if (bb_is_set(occupied_sq_bb, to_sq)) {
-                    const struct move mv = move_encode_capture(from_sq, to_sq);
-                    mvl_add(mvl, mv);
-                } else {
-                    const struct move mv = move_encode_quiet(from_sq, to_sq);
-                    mvl_add(mvl, mv);
-                }
-            } else if (bb_is_set(occupied_sq_bb, to_sq)) {
-                const struct move mv = move_encode_capture(from_sq, to_sq);
-                mvl_add(mvl, mv);
-            }
+    if (masks.checkers != 0) {
+        mv_gen_evasions(pos, mvl, &masks);
+    } else {
+        mv_gen_moves(pos, mvl, ALL_MOVES);
+    }
+
+    // compact the list, dropping the illegal moves
+    uint16_t num_legal = first_new_move;
+    for (uint16_t i = first_new_move; i < mvl->move_count; i++) {
+        const struct move mv = mvl->move_list[i];
+        if (is_legal_move(pos, &masks, mv)) {
+            mvl->move_list[num_legal] = mv;
+            num_legal++;
         }
     }
+    mvl->move_count = num_legal;
+}
+
+static void mv_gen_moves(const struct position *const pos, struct move_list *const mvl, enum move_gen_type gen_type) {
+    switch (pos_get_side_to_move(pos)) {
+    case WHITE:
+        mv_gen_moves_white(pos, mvl, gen_type);
+        break;
+    case BLACK:
+        mv_gen_moves_black(pos, mvl, gen_type);
+        break;
+    default:
+        break;
+    }
+}
+
+static void mv_gen_evasions(const struct position *const pos, struct move_list *const mvl,
+                            const struct legal_move_masks *const masks) {
+    switch (pos_get_side_to_move(pos)) {
+    case WHITE:
+        mv_gen_evasions_white(pos, mvl, masks);
+        break;
+    case BLACK:
+        mv_gen_evasions_black(pos, mvl, masks);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Builds the capture and quiet target masks for the move types being generated
+ *
+ * @param brd               the board
+ * @param opposing_colour   the side not moving
+ * @param gen_type          the move types to generate
+ * @param target_bb         bitboard of allowed target squares
+ * @return the target masks
+ */
+static struct move_targets get_move_targets(const struct board *const brd, const enum colour opposing_colour,
+                                            const enum move_gen_type gen_type, const uint64_t target_bb) {
+    const struct move_targets targets = {
+        .capture = gen_type != QUIET_ONLY ? brd_get_colour_bb(brd, opposing_colour) & target_bb : 0,
+        .quiet = gen_type != CAPTURE_ONLY ? ~brd_get_board_bb(brd) & target_bb : 0,
+    };
+    return targets;
+}
+
+static uint32_t count_bits(const uint64_t bb) {
+    return (uint32_t)__builtin_popcountll(bb);
 }
 
 static void gen_promotions(enum square from_sq, enum square to_sq, struct move_list *const mvl) {
@@ -501,97 +371,71 @@ static void gen_promotions_with_capture(enum square from_sq, enum square to_sq,
 }
 
 /**
- * @brief Generates Knight moves
- * 
- * @param pos           the game position
- * @param mvl           the move list
- * @param gen_type      the move types to generate
+ * @brief Generates quiet moves using the given bitboard and source square.
+ *
+ * @param bb A bitboard repesenting all possible non-occupied squares.
+ * @param from_sq The source ("from") square
+ * @param mvl Pointer to a move list. All generated moves are appended to this list.
  */
-static void mv_gen_knight_moves(const struct position *const pos, struct move_list *const mvl,
-                                enum move_gen_type gen_type) {
-
-    assert((gen_type == CAPTURE_ONLY) || (gen_type == ALL_MOVES));
-
-    const struct board *const brd = pos_get_board(pos);
-
-    const enum colour side_to_move = pos_get_side_to_move(pos);
-    const enum colour opposing_colour = pce_swap_side(side_to_move);
-
-    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
-    const uint64_t opposite_colour_bb = brd_get_colour_bb(brd, opposing_colour);
-
-    uint64_t knight_bb = brd_get_bb_for_role_colour(brd, KNIGHT, side_to_move);
-    while (knight_bb != 0) {
-        const enum square from_sq = bb_pop_1st_bit_and_clear(&knight_bb);
-        const uint64_t occ_mask = occ_mask_get_knight(from_sq);
-
-        switch (gen_type) {
-        case CAPTURE_ONLY:
-            mv_gen_encode_multiple_capture((occ_mask & opposite_colour_bb), from_sq, mvl);
-            break;
-        case ALL_MOVES:
-            // captures
-            mv_gen_encode_multiple_capture((occ_mask & opposite_colour_bb), from_sq, mvl);
-            // quiet moves
-            mv_gen_encode_multiple_quiet((~occupied_sq_bb & occ_mask), from_sq, mvl);
-            break;
-        default:
-            print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid move gen type");
-            break;
-        }
+static void mv_gen_encode_multiple_quiet(uint64_t bb, enum square from_sq, struct move_list *const mvl) {
+    while (bb != 0) {
+        const enum square empty_sq = bb_pop_1st_bit_and_clear(&bb);
+        const struct move quiet_move = move_encode_quiet(from_sq, empty_sq);
+        mvl_add(mvl, quiet_move);
     }
 }
 
 /**
- * @brief Generates King moves
- * 
- * @param pos           Current position
- * @param mvl           the move list
- * @param gen_type      the move types to generate
+ * @brief Generates quiet pawn moves for a set of target squares
+ *
+ * @param to_bb Bitboard of target squares
+ * @param sq_delta The difference between the target and source squares (eg, +8 for a White single push)
+ * @param is_double True if these are double first moves
+ * @param mvl Pointer to a move list. All generated moves are appended to this list.
  */
-static void mv_gen_king_moves(const struct position *const pos, struct move_list *const mvl,
-                              enum move_gen_type gen_type) {
-
-    assert((gen_type == CAPTURE_ONLY) || (gen_type == ALL_MOVES));
-
-    const struct board *const brd = pos_get_board(pos);
-
-    const enum colour side_to_move = pos_get_side_to_move(pos);
-    const enum colour opposing_colour = pce_swap_side(side_to_move);
-    const enum square king_sq = brd_get_king_square(brd, side_to_move);
-
-    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
-    const uint64_t occ_mask = occ_mask_get_king(king_sq);
-    const uint64_t opposite_colour_bb = brd_get_colour_bb(brd, opposing_colour);
+static void mv_gen_encode_pawn_quiet(uint64_t to_bb, int sq_delta, bool is_double, struct move_list *const mvl) {
+    while (to_bb != 0) {
+        const enum square to_sq = bb_pop_1st_bit_and_clear(&to_bb);
+        const enum square from_sq = (enum square)((int)to_sq - sq_delta);
+        const struct move mv =
+            is_double ? move_encode_pawn_double_first(from_sq, to_sq) : move_encode_quiet(from_sq, to_sq);
+        mvl_add(mvl, mv);
+    }
+}
 
-    switch (gen_type) {
-    case CAPTURE_ONLY:
-        mv_gen_encode_multiple_capture((occ_mask & opposite_colour_bb), king_sq, mvl);
-        break;
-    case ALL_MOVES:
-        // captures
-        mv_gen_encode_multiple_capture((occ_mask & opposite_colour_bb), king_sq, mvl);
-        // quiet
-        mv_gen_encode_multiple_quiet((~occupied_sq_bb & occ_mask), king_sq, mvl);
-        break;
-    default:
-        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid move gen type");
-        break;
+/**
+ * @brief Generates pawn capture moves for a set of target squares
+ *
+ * @param to_bb Bitboard of target squares
+ * @param sq_delta The difference between the target and source squares
+ * @param mvl Pointer to a move list. All generated moves are appended to this list.
+ */
+static void mv_gen_encode_pawn_captures(uint64_t to_bb, int sq_delta, struct move_list *const mvl) {
+    while (to_bb != 0) {
+        const enum square to_sq = bb_pop_1st_bit_and_clear(&to_bb);
+        const enum square from_sq = (enum square)((int)to_sq - sq_delta);
+        mvl_add(mvl, move_encode_capture(from_sq, to_sq));
     }
 }
 
 /**
- * @brief Generates quiet moves using the given bitboard and source square.
+ * @brief Generates all 4 promotion moves for each of a set of target squares
  *
- * @param bb A bitboard repesenting all possible non-occupied squares.
- * @param from_sq The source ("from") square
+ * @param to_bb Bitboard of target squares
+ * @param sq_delta The difference between the target and source squares
+ * @param is_capture True if the promotions are also captures
  * @param mvl Pointer to a move list. All generated moves are appended to this list.
  */
-static void mv_gen_encode_multiple_quiet(uint64_t bb, enum square from_sq, struct move_list *const mvl) {
-    while (bb != 0) {
-        const enum square empty_sq = bb_pop_1st_bit_and_clear(&bb);
-        const struct move quiet_move = move_encode_quiet(from_sq, empty_sq);
-        mvl_add(mvl, quiet_move);
+static void mv_gen_encode_pawn_promotions(uint64_t to_bb, int sq_delta, bool is_capture,
+                                          struct move_list *const mvl) {
+    while (to_bb != 0) {
+        const enum square to_sq = bb_pop_1st_bit_and_clear(&to_bb);
+        const enum square from_sq = (enum square)((int)to_sq - sq_delta);
+        if (is_capture) {
+            gen_promotions_with_capture(from_sq, to_sq, mvl);
+        } else {
+            gen_promotions(from_sq, to_sq, mvl);
+        }
     }
 }
 
@@ -610,34 +454,216 @@ static void mv_gen_encode_multiple_capture(uint64_t bb, enum square from_sq, str
     }
 }
 
-static void mv_gen_white_castle_moves(struct move_list *const mvl, const struct cast_perm_container cp,
-                                      uint64_t all_pce_bb) {
-    if (cast_perm_has_white_kingside_permissions(cp)) {
-        if ((all_pce_bb & CASTLE_SQ_MASK_WK) == 0) {
-            const struct move mv = move_encode_castle_kingside_white();
-            mvl_add(mvl, mv);
+/**
+ * @brief Generates quiet checking moves for one type of slider
+ *
+ * @param slider_bb     bitboard of the sliders to move
+ * @param is_diagonal   true if the sliders move diagonally
+ * @param is_orthogonal true if the sliders move along ranks and files
+ * @param check_bb      squares from which this slider type attacks the opposing King
+ * @param masks         occupancy and discovered check state
+ * @param mvl           the move list
+ */
+static void mv_gen_slider_quiet_checks(uint64_t slider_bb, const bool is_diagonal, const bool is_orthogonal,
+                                       const uint64_t check_bb, const struct slider_check_masks *const masks,
+                                       struct move_list *const mvl) {
+    while (slider_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&slider_bb);
+
+        uint64_t attacks = 0;
+        if (is_diagonal) {
+            attacks |= occ_mask_get_bishop_attacks(from_sq, masks->occupied);
+        }
+        if (is_orthogonal) {
+            attacks |= occ_mask_get_rook_attacks(from_sq, masks->occupied);
         }
+        const uint64_t quiet_bb = attacks & ~masks->occupied;
+
+        uint64_t to_bb = quiet_bb & check_bb;
+        if ((masks->discoverers & SQUARE_AS_BITBOARD(from_sq)) != 0) {
+            to_bb |= quiet_bb & ~masks->blocker_line[from_sq];
+        }
+        mv_gen_encode_multiple_quiet(to_bb, from_sq, mvl);
     }
-    if (cast_perm_has_white_queenside_permissions(cp)) {
-        if ((all_pce_bb & CASTLE_SQ_MASK_WQ) == 0) {
-            const struct move mv = move_encode_castle_queenside_white();
-            mvl_add(mvl, mv);
+}
+
+/**
+ * @brief Finds our pieces that are the only piece between one of our sliders and the opposing King
+ *
+ * @param brd           the board
+ * @param side_to_move  the side to move
+ * @param opp_king_sq   the opposing King square
+ * @param blocker_line  populated, for each blocker found, with the squares between the King and the slider
+ * @return bitboard of the blocking pieces
+ */
+static uint64_t get_discovered_check_blockers(const struct board *const brd, const enum colour side_to_move,
+                                              const enum square opp_king_sq, uint64_t *const blocker_line) {
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t our_pce_bb = brd_get_colour_bb(brd, side_to_move);
+    const uint64_t queen_bb = brd_get_bb_for_role_colour(brd, QUEEN, side_to_move);
+    const uint64_t rook_queen_bb = brd_get_bb_for_role_colour(brd, ROOK, side_to_move) | queen_bb;
+    const uint64_t bishop_queen_bb = brd_get_bb_for_role_colour(brd, BISHOP, side_to_move) | queen_bb;
+
+    // look from the King through everything except our sliders of the matching type
+    uint64_t candidates_bb = (occ_mask_get_rook_attacks(opp_king_sq, rook_queen_bb) & rook_queen_bb) |
+                             (occ_mask_get_bishop_attacks(opp_king_sq, bishop_queen_bb) & bishop_queen_bb);
+
+    uint64_t discoverers_bb = 0;
+    while (candidates_bb != 0) {
+        const enum square slider_sq = bb_pop_1st_bit_and_clear(&candidates_bb);
+        const uint64_t line_bb = occ_mask_get_inbetween(opp_king_sq, slider_sq);
+        uint64_t blockers_bb = line_bb & occupied_sq_bb;
+
+        const bool single_blocker = blockers_bb != 0 && (blockers_bb & (blockers_bb - 1)) == 0;
+        if (single_blocker && (blockers_bb & our_pce_bb) != 0) {
+            const enum square blocker_sq = bb_pop_1st_bit_and_clear(&blockers_bb);
+            discoverers_bb |= SQUARE_AS_BITBOARD(blocker_sq);
+            blocker_line[blocker_sq] = line_bb;
         }
     }
+    return discoverers_bb;
+}
+
+/**
+ * @brief Populates the King square, checkers and check evasion squares for the side to move
+ */
+static void init_check_masks(const struct position *const pos, struct legal_move_masks *const masks) {
+    const struct board *const brd = pos_get_board(pos);
+
+    const enum colour side_to_move = pos_get_side_to_move(pos);
+    const enum square king_sq = brd_get_king_square(brd, side_to_move);
+
+    masks->king_sq = king_sq;
+    masks->checkers = pos_get_checkers(pos);
+
+    if (masks->checkers == 0) {
+        masks->check_evasion = ALL_SQUARES_BB;
+    } else if ((masks->checkers & (masks->checkers - 1)) == 0) {
+        uint64_t checkers = masks->checkers;
+        const enum square checker_sq = bb_pop_1st_bit_and_clear(&checkers);
+        masks->check_evasion = masks->checkers | occ_mask_get_inbetween(king_sq, checker_sq);
+    } else {
+        masks->check_evasion = 0;
+    }
 }
 
-static void mv_gen_black_castle_moves(struct move_list *const mvl, const struct cast_perm_container cp,
-                                      uint64_t all_pce_bb) {
-    if (cast_perm_has_black_kingside_permissions(cp)) {
-        if ((all_pce_bb & CASTLE_SQ_MASK_BK) == 0) {
-            const struct move mv = move_encode_castle_kingside_black();
-            mvl_add(mvl, mv);
+static void init_legal_move_masks(const struct position *const pos, struct legal_move_masks *const masks) {
+    init_check_masks(pos, masks);
+
+    const struct board *const brd = pos_get_board(pos);
+
+    const enum colour side_to_move = pos_get_side_to_move(pos);
+    const enum colour opposing_colour = pce_swap_side(side_to_move);
+    const enum square king_sq = masks->king_sq;
+
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t our_pce_bb = brd_get_colour_bb(brd, side_to_move);
+    const uint64_t opposite_colour_bb = brd_get_colour_bb(brd, opposing_colour);
+    const uint64_t rook_queen_bb = brd_get_bb_for_role_colour(brd, ROOK, opposing_colour) |
+                                   brd_get_bb_for_role_colour(brd, QUEEN, opposing_colour);
+    const uint64_t bishop_queen_bb = brd_get_bb_for_role_colour(brd, BISHOP, opposing_colour) |
+                                     brd_get_bb_for_role_colour(brd, QUEEN, opposing_colour);
+
+    // pinned pieces : look through our own pieces to find the opposing sliders lined up with our King, and
+    // check if there's exactly one of our pieces in between
+    masks->pinned = 0;
+    uint64_t pinners_bb = (occ_mask_get_rook_attacks(king_sq, opposite_colour_bb) & rook_queen_bb) |
+                          (occ_mask_get_bishop_attacks(king_sq, opposite_colour_bb) & bishop_queen_bb);
+    while (pinners_bb != 0) {
+        const enum square pinner_sq = bb_pop_1st_bit_and_clear(&pinners_bb);
+        const uint64_t ray_bb = occ_mask_get_inbetween(king_sq, pinner_sq);
+        uint64_t blockers_bb = ray_bb & occupied_sq_bb;
+
+        const bool single_blocker = blockers_bb != 0 && (blockers_bb & (blockers_bb - 1)) == 0;
+        if (single_blocker && (blockers_bb & our_pce_bb) != 0) {
+            const enum square pinned_sq = bb_pop_1st_bit_and_clear(&blockers_bb);
+            masks->pinned |= SQUARE_AS_BITBOARD(pinned_sq);
+            masks->pin_ray[pinned_sq] = ray_bb | SQUARE_AS_BITBOARD(pinner_sq);
         }
     }
-    if (cast_perm_has_black_queenside_permissions(cp)) {
-        if ((all_pce_bb & CASTLE_SQ_MASK_BQ) == 0) {
-            const struct move mv = move_encode_castle_queenside_black();
-            mvl_add(mvl, mv);
+
+    // remove the King so squares behind it, on the line of a checking slider, are seen as attacked
+    masks->king_danger = get_attacked_squares(brd, opposing_colour, occupied_sq_bb & ~SQUARE_AS_BITBOARD(king_sq));
+}
+
+static uint64_t get_attacked_squares(const struct board *const brd, enum colour attacking_side, uint64_t occupied) {
+    const uint64_t pawn_bb = brd_get_bb_for_role_colour(brd, PAWN, attacking_side);
+    uint64_t attacked_bb = attacking_side == WHITE ? (NORTH_EAST(pawn_bb) | NORTH_WEST(pawn_bb))
+                                                   : (SOUTH_EAST(pawn_bb) | SOUTH_WEST(pawn_bb));
+
+    uint64_t knight_bb = brd_get_bb_for_role_colour(brd, KNIGHT, attacking_side);
+    while (knight_bb != 0) {
+        attacked_bb |= occ_mask_get_knight(bb_pop_1st_bit_and_clear(&knight_bb));
+    }
+
+    const uint64_t queen_bb = brd_get_bb_for_role_colour(brd, QUEEN, attacking_side);
+
+    uint64_t bishop_queen_bb = brd_get_bb_for_role_colour(brd, BISHOP, attacking_side) | queen_bb;
+    while (bishop_queen_bb != 0) {
+        attacked_bb |= occ_mask_get_bishop_attacks(bb_pop_1st_bit_and_clear(&bishop_queen_bb), occupied);
+    }
+
+    uint64_t rook_queen_bb = brd_get_bb_for_role_colour(brd, ROOK, attacking_side) | queen_bb;
+    while (rook_queen_bb != 0) {
+        attacked_bb |= occ_mask_get_rook_attacks(bb_pop_1st_bit_and_clear(&rook_queen_bb), occupied);
+    }
+
+    attacked_bb |= occ_mask_get_king(brd_get_king_square(brd, attacking_side));
+
+    return attacked_bb;
+}
+
+static bool is_legal_move(const struct position *const pos, const struct legal_move_masks *const masks,
+                          struct move mv) {
+    const enum square from_sq = move_decode_from_sq(mv);
+    const enum square to_sq = move_decode_to_sq(mv);
+
+    if (from_sq == masks->king_sq) {
+        if (move_is_castle(mv)) {
+            // can't castle out of check, or through/into an attacked square
+            const uint64_t king_path_bb = occ_mask_get_inbetween(from_sq, to_sq) | SQUARE_AS_BITBOARD(to_sq);
+            return masks->checkers == 0 && (king_path_bb & masks->king_danger) == 0;
         }
+        return bb_is_clear(masks->king_danger, to_sq);
+    }
+
+    if (move_get_move_type(mv) == MV_TYPE_EN_PASS) {
+        return is_en_passant_legal(pos, masks, from_sq, to_sq);
+    }
+
+    if (bb_is_set(masks->pinned, from_sq) && bb_is_clear(masks->pin_ray[from_sq], to_sq)) {
+        return false;
     }
+
+    return bb_is_set(masks->check_evasion, to_sq);
+}
+
+static bool is_en_passant_legal(const struct position *const pos, const struct legal_move_masks *const masks,
+                                enum square from_sq, enum square to_sq) {
+    const struct board *const brd = pos_get_board(pos);
+
+    const enum colour side_to_move = pos_get_side_to_move(pos);
+    const enum colour opposing_colour = pce_swap_side(side_to_move);
+
+    const enum square capture_sq =
+        side_to_move == WHITE ? sq_get_square_minus_1_rank(to_sq) : sq_get_square_plus_1_rank(to_sq);
+    const uint64_t capture_bb = SQUARE_AS_BITBOARD(capture_sq);
+
+    const uint64_t rook_queen_bb = brd_get_bb_for_role_colour(brd, ROOK, opposing_colour) |
+                                   brd_get_bb_for_role_colour(brd, QUEEN, opposing_colour);
+    const uint64_t bishop_queen_bb = brd_get_bb_for_role_colour(brd, BISHOP, opposing_colour) |
+                                     brd_get_bb_for_role_colour(brd, QUEEN, opposing_colour);
+
+    // a Knight or Pawn check can only be resolved if the checking piece is the pawn being captured
+    if ((masks->checkers & ~(capture_bb | rook_queen_bb | bishop_queen_bb)) != 0) {
+        return false;
+    }
+
+    // both pawns leave their squares, so test for discovered slider attacks (including the rank-pin case
+    // where both pawns are between the King and a Rook/Queen)
+    const uint64_t occupied_after_bb =
+        (brd_get_board_bb(brd) & ~(SQUARE_AS_BITBOARD(from_sq) | capture_bb)) | SQUARE_AS_BITBOARD(to_sq);
+
+    return (occ_mask_get_rook_attacks(masks->king_sq, occupied_after_bb) & rook_queen_bb) == 0 &&
+           (occ_mask_get_bishop_attacks(masks->king_sq, occupied_after_bb) & bishop_queen_bb) == 0;
 }
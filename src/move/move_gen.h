@@ -30,4 +30,9 @@
 #include "position.h"
 
 void mv_gen_all_moves(const struct position *const pos, struct move_list *const mvl);
+void mv_gen_evasion_moves(const struct position *const pos, struct move_list *const mvl);
+void mv_gen_legal_moves(const struct position *const pos, struct move_list *const mvl);
+uint16_t mv_gen_count_legal_moves(const struct position *const pos);
 void mv_gen_only_capture_moves(const struct position *const pos, struct move_list *const mvl);
+void mv_gen_quiet_moves(const struct position *const pos, struct move_list *const mvl);
+void mv_gen_quiet_check_moves(const struct position *const pos, struct move_list *const mvl);
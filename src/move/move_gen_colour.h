@@ -0,0 +1,530 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+/*
+ * Colour-specialised move generation.
+ *
+ * This file is a template, included once per colour by move_gen.c, so it deliberately has no include
+ * guard. Before each inclusion the includer defines:
+ *
+ *      GEN_IS_WHITE    1 to generate White moves, 0 to generate Black moves
+ *      GEN_FN(name)    the name of each generated function, eg name##_white
+ *
+ * The colour, pawn direction, promotion rank and castle masks are then compile-time constants in
+ * each instantiation, so the generators don't need to branch on the side to move.
+ */
+
+#if !defined(GEN_IS_WHITE) || !defined(GEN_FN)
+#error "move_gen_colour.h is a template and must only be included by move_gen.c"
+#endif
+
+// clang-format off
+#if GEN_IS_WHITE
+#define GEN_US                      WHITE
+#define GEN_THEM                    BLACK
+#define GEN_PAWN                    WHITE_PAWN
+#define GEN_PUSH(bb)                NORTH(bb)
+#define GEN_PUSH_BACK(bb)           SOUTH(bb)
+#define GEN_CAPT_EAST(bb)           NORTH_EAST(bb)
+#define GEN_CAPT_WEST(bb)           NORTH_WEST(bb)
+#define GEN_PUSH_DELTA              8
+#define GEN_CAPT_EAST_DELTA         9
+#define GEN_CAPT_WEST_DELTA         7
+#define GEN_PROMO_FROM_BB           RANK_7_BB
+#define GEN_DOUBLE_PUSH_BB          RANK_3_BB
+#define GEN_CASTLE_MASK_K           CASTLE_SQ_MASK_WK
+#define GEN_CASTLE_MASK_Q           CASTLE_SQ_MASK_WQ
+#define GEN_CASTLE_PATH_Q           CASTLE_KING_PATH_WQ
+#define GEN_HAS_CASTLE_PERM(cp)     cast_perm_has_white_permissions(cp)
+#define GEN_HAS_CASTLE_PERM_K(cp)   cast_perm_has_white_kingside_permissions(cp)
+#define GEN_HAS_CASTLE_PERM_Q(cp)   cast_perm_has_white_queenside_permissions(cp)
+#define GEN_ENCODE_CASTLE_K()       move_encode_castle_kingside_white()
+#define GEN_ENCODE_CASTLE_Q()       move_encode_castle_queenside_white()
+#define GEN_PAWNS_ATTACKING_SQ(sq)  occ_mask_get_bb_white_pawns_attacking_sq(sq)
+#else
+#define GEN_US                      BLACK
+#define GEN_THEM                    WHITE
+#define GEN_PAWN                    BLACK_PAWN
+#define GEN_PUSH(bb)                SOUTH(bb)
+#define GEN_PUSH_BACK(bb)           NORTH(bb)
+#define GEN_CAPT_EAST(bb)           SOUTH_EAST(bb)
+#define GEN_CAPT_WEST(bb)           SOUTH_WEST(bb)
+#define GEN_PUSH_DELTA              (-8)
+#define GEN_CAPT_EAST_DELTA         (-7)
+#define GEN_CAPT_WEST_DELTA         (-9)
+#define GEN_PROMO_FROM_BB           RANK_2_BB
+#define GEN_DOUBLE_PUSH_BB          RANK_6_BB
+#define GEN_CASTLE_MASK_K           CASTLE_SQ_MASK_BK
+#define GEN_CASTLE_MASK_Q           CASTLE_SQ_MASK_BQ
+#define GEN_CASTLE_PATH_Q           CASTLE_KING_PATH_BQ
+#define GEN_HAS_CASTLE_PERM(cp)     cast_perm_has_black_permissions(cp)
+#define GEN_HAS_CASTLE_PERM_K(cp)   cast_perm_has_black_kingside_permissions(cp)
+#define GEN_HAS_CASTLE_PERM_Q(cp)   cast_perm_has_black_queenside_permissions(cp)
+#define GEN_ENCODE_CASTLE_K()       move_encode_castle_kingside_black()
+#define GEN_ENCODE_CASTLE_Q()       move_encode_castle_queenside_black()
+#define GEN_PAWNS_ATTACKING_SQ(sq)  occ_mask_get_bb_black_pawns_attacking_sq(sq)
+#endif
+// clang-format on
+
+/**
+ * @brief Generates pawn moves, set-wise for all pawns at once
+ *
+ * @param pos           the game position
+ * @param mvl           the move list
+ * @param targets       allowed capture and quiet target squares
+ */
+static void GEN_FN(mv_gen_pawn_moves)(const struct position *const pos, struct move_list *const mvl,
+                                      const struct move_targets *const targets) {
+    assert(validate_position(pos));
+    assert(validate_move_list(mvl));
+
+    const struct board *const brd = pos_get_board(pos);
+
+    const uint64_t all_pawns_bb = brd_get_piece_bb(brd, GEN_PAWN);
+    const uint64_t promo_pawns_bb = all_pawns_bb & GEN_PROMO_FROM_BB;
+    const uint64_t non_promo_pawns_bb = all_pawns_bb & ~GEN_PROMO_FROM_BB;
+    const uint64_t empty_bb = ~brd_get_board_bb(brd);
+
+    // quiet moves, the target mask is empty if quiet moves aren't being generated
+    const uint64_t all_single_bb = GEN_PUSH(non_promo_pawns_bb) & empty_bb;
+    const uint64_t single_from_start_bb = all_single_bb & GEN_DOUBLE_PUSH_BB;
+    const uint64_t double_bb = GEN_PUSH(single_from_start_bb) & targets->quiet;
+    const uint64_t single_bb = all_single_bb & targets->quiet;
+    const uint64_t promo_bb = GEN_PUSH(promo_pawns_bb) & targets->quiet;
+
+    mv_gen_encode_pawn_quiet(double_bb, 2 * GEN_PUSH_DELTA, true, mvl);
+    mv_gen_encode_pawn_quiet(single_bb, GEN_PUSH_DELTA, false, mvl);
+    mv_gen_encode_pawn_promotions(promo_bb, GEN_PUSH_DELTA, false, mvl);
+
+    // captures, the target mask is empty if captures aren't being generated
+    if (pos_is_en_passant_active(pos)) {
+        const enum square en_pass_sq = pos_get_en_pass_sq(pos);
+        const uint64_t en_pass_bb = SQUARE_AS_BITBOARD(en_pass_sq);
+        const uint64_t captured_bb = GEN_PUSH_BACK(en_pass_bb);
+
+        if ((captured_bb & targets->capture) != 0) {
+            uint64_t att_enp_pawn_bb = all_pawns_bb & GEN_PAWNS_ATTACKING_SQ(en_pass_sq);
+            while (att_enp_pawn_bb != 0) {
+                const enum square from_sq = bb_pop_1st_bit_and_clear(&att_enp_pawn_bb);
+                mvl_add(mvl, move_encode_enpassant(from_sq, en_pass_sq));
+            }
+        }
+    }
+
+    const uint64_t capt_east_bb = GEN_CAPT_EAST(non_promo_pawns_bb) & targets->capture;
+    const uint64_t capt_west_bb = GEN_CAPT_WEST(non_promo_pawns_bb) & targets->capture;
+    const uint64_t promo_capt_east_bb = GEN_CAPT_EAST(promo_pawns_bb) & targets->capture;
+    const uint64_t promo_capt_west_bb = GEN_CAPT_WEST(promo_pawns_bb) & targets->capture;
+
+    mv_gen_encode_pawn_captures(capt_east_bb, GEN_CAPT_EAST_DELTA, mvl);
+    mv_gen_encode_pawn_captures(capt_west_bb, GEN_CAPT_WEST_DELTA, mvl);
+    mv_gen_encode_pawn_promotions(promo_capt_east_bb, GEN_CAPT_EAST_DELTA, true, mvl);
+    mv_gen_encode_pawn_promotions(promo_capt_west_bb, GEN_CAPT_WEST_DELTA, true, mvl);
+}
+
+/**
+ * @brief Generates castle moves, if the squares between King and Rook are empty
+ *
+ * @param mvl           the move list
+ * @param cp            the castle permissions
+ * @param all_pce_bb    bitboard of all occupied squares
+ */
+static void GEN_FN(mv_gen_castle_moves)(struct move_list *const mvl, const struct cast_perm_container cp,
+                                        const uint64_t all_pce_bb) {
+    if (GEN_HAS_CASTLE_PERM_K(cp) && (all_pce_bb & GEN_CASTLE_MASK_K) == 0) {
+        mvl_add(mvl, GEN_ENCODE_CASTLE_K());
+    }
+    if (GEN_HAS_CASTLE_PERM_Q(cp) && (all_pce_bb & GEN_CASTLE_MASK_Q) == 0) {
+        mvl_add(mvl, GEN_ENCODE_CASTLE_Q());
+    }
+}
+
+/**
+ * @brief Generates Knight moves
+ *
+ * @param brd           the board
+ * @param mvl           the move list
+ * @param targets       allowed capture and quiet target squares
+ */
+static void GEN_FN(mv_gen_knight_moves)(const struct board *const brd, struct move_list *const mvl,
+                                        const struct move_targets *const targets) {
+    uint64_t knight_bb = brd_get_bb_for_role_colour(brd, KNIGHT, GEN_US);
+    while (knight_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&knight_bb);
+        const uint64_t occ_mask = occ_mask_get_knight(from_sq);
+
+        mv_gen_encode_multiple_capture(occ_mask & targets->capture, from_sq, mvl);
+        mv_gen_encode_multiple_quiet(occ_mask & targets->quiet, from_sq, mvl);
+    }
+}
+
+/**
+ * @brief Generates King moves, excluding castling
+ *
+ * @param brd           the board
+ * @param mvl           the move list
+ * @param targets       allowed capture and quiet target squares
+ */
+static void GEN_FN(mv_gen_king_moves)(const struct board *const brd, struct move_list *const mvl,
+                                      const struct move_targets *const targets) {
+    const enum square king_sq = brd_get_king_square(brd, GEN_US);
+    const uint64_t occ_mask = occ_mask_get_king(king_sq);
+
+    mv_gen_encode_multiple_capture(occ_mask & targets->capture, king_sq, mvl);
+    mv_gen_encode_multiple_quiet(occ_mask & targets->quiet, king_sq, mvl);
+}
+
+/**
+ * @brief Generates sliding diagonal and antidiagonal moves, for Bishops and Queens
+ *
+ * @param brd           the board
+ * @param mvl           the move list
+ * @param targets       allowed capture and quiet target squares
+ */
+static void GEN_FN(mv_gen_diagonal_moves)(const struct board *const brd, struct move_list *const mvl,
+                                          const struct move_targets *const targets) {
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+
+    uint64_t pce_to_move_bb =
+        brd_get_bb_for_role_colour(brd, BISHOP, GEN_US) | brd_get_bb_for_role_colour(brd, QUEEN, GEN_US);
+    while (pce_to_move_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&pce_to_move_bb);
+        const uint64_t attacks = occ_mask_get_bishop_attacks(from_sq, occupied_sq_bb);
+
+        mv_gen_encode_multiple_capture(attacks & targets->capture, from_sq, mvl);
+        mv_gen_encode_multiple_quiet(attacks & targets->quiet, from_sq, mvl);
+    }
+}
+
+/**
+ * @brief Generates sliding rank and file moves, for Rooks and Queens
+ *
+ * @param brd           the board
+ * @param mvl           the move list
+ * @param targets       allowed capture and quiet target squares
+ */
+static void GEN_FN(mv_gen_rank_file_moves)(const struct board *const brd, struct move_list *const mvl,
+                                           const struct move_targets *const targets) {
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+
+    uint64_t pce_to_move_bb =
+        brd_get_bb_for_role_colour(brd, ROOK, GEN_US) | brd_get_bb_for_role_colour(brd, QUEEN, GEN_US);
+    while (pce_to_move_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&pce_to_move_bb);
+        const uint64_t attacks = occ_mask_get_rook_attacks(from_sq, occupied_sq_bb);
+
+        mv_gen_encode_multiple_capture(attacks & targets->capture, from_sq, mvl);
+        mv_gen_encode_multiple_quiet(attacks & targets->quiet, from_sq, mvl);
+    }
+}
+
+/**
+ * @brief Generates moves of the given type
+ *
+ * @param pos           the game position
+ * @param mvl           the move list
+ * @param gen_type      the move types to generate
+ */
+static void GEN_FN(mv_gen_moves)(const struct position *const pos, struct move_list *const mvl,
+                                 const enum move_gen_type gen_type) {
+    const struct board *const brd = pos_get_board(pos);
+    const struct cast_perm_container castle_perms = pos_get_cast_perm(pos);
+    const struct move_targets targets = get_move_targets(brd, GEN_THEM, gen_type, ALL_SQUARES_BB);
+
+    if (GEN_HAS_CASTLE_PERM(castle_perms) && (gen_type != CAPTURE_ONLY)) {
+        GEN_FN(mv_gen_castle_moves)(mvl, castle_perms, brd_get_board_bb(brd));
+    }
+
+    GEN_FN(mv_gen_pawn_moves)(pos, mvl, &targets);
+    GEN_FN(mv_gen_king_moves)(brd, mvl, &targets);
+    GEN_FN(mv_gen_knight_moves)(brd, mvl, &targets);
+    GEN_FN(mv_gen_diagonal_moves)(brd, mvl, &targets);
+    GEN_FN(mv_gen_rank_file_moves)(brd, mvl, &targets);
+}
+
+/**
+ * @brief Generates moves that try to get the side to move out of check
+ *
+ * @details King moves are restricted to squares not attacked by the opposing side. In single check, other
+ * pieces can only capture the checking piece or interpose between it and the King. In double check, only
+ * King moves are generated. Moves by pinned pieces are not filtered out.
+ *
+ * @param pos           the game position
+ * @param mvl           the move list
+ * @param masks         check masks for the position, including king_danger
+ */
+static void GEN_FN(mv_gen_evasions)(const struct position *const pos, struct move_list *const mvl,
+                                    const struct legal_move_masks *const masks) {
+    assert(masks->checkers != 0);
+
+    const struct board *const brd = pos_get_board(pos);
+
+    const struct move_targets king_targets = get_move_targets(brd, GEN_THEM, ALL_MOVES, ~masks->king_danger);
+    GEN_FN(mv_gen_king_moves)(brd, mvl, &king_targets);
+
+    const bool is_double_check = (masks->checkers & (masks->checkers - 1)) != 0;
+    if (is_double_check) {
+        // only a King move can escape
+        return;
+    }
+
+    // an en passant capture can only resolve the check by capturing the checking pawn, as it's not
+    // possible for the en passant square to be between the King and a checking slider
+    const struct move_targets targets = get_move_targets(brd, GEN_THEM, ALL_MOVES, masks->check_evasion);
+    GEN_FN(mv_gen_pawn_moves)(pos, mvl, &targets);
+    GEN_FN(mv_gen_knight_moves)(brd, mvl, &targets);
+    GEN_FN(mv_gen_diagonal_moves)(brd, mvl, &targets);
+    GEN_FN(mv_gen_rank_file_moves)(brd, mvl, &targets);
+}
+
+/**
+ * @brief Generates quiet, non-promotion pawn moves that give check
+ *
+ * @param brd               the board
+ * @param mvl               the move list
+ * @param pawn_check_bb     squares from which a pawn attacks the opposing King
+ * @param discoverers_bb    our pieces blocking a line to the opposing King
+ * @param blocker_line      for each discoverer, the line it's blocking
+ */
+static void GEN_FN(mv_gen_pawn_quiet_checks)(const struct board *const brd, struct move_list *const mvl,
+                                             const uint64_t pawn_check_bb, const uint64_t discoverers_bb,
+                                             const uint64_t *const blocker_line) {
+    const uint64_t empty_bb = ~brd_get_board_bb(brd);
+    const uint64_t pawns_bb = brd_get_piece_bb(brd, GEN_PAWN) & ~GEN_PROMO_FROM_BB;
+
+    // direct checks, set-wise
+    const uint64_t direct_pawns_bb = pawns_bb & ~discoverers_bb;
+    const uint64_t single_bb = GEN_PUSH(direct_pawns_bb) & empty_bb;
+    const uint64_t single_from_start_bb = single_bb & GEN_DOUBLE_PUSH_BB;
+    const uint64_t double_bb = GEN_PUSH(single_from_start_bb) & empty_bb;
+
+    mv_gen_encode_pawn_quiet(double_bb & pawn_check_bb, 2 * GEN_PUSH_DELTA, true, mvl);
+    mv_gen_encode_pawn_quiet(single_bb & pawn_check_bb, GEN_PUSH_DELTA, false, mvl);
+
+    // discovered checks, a pawn only fails to discover check when pushing along a blocked file
+    uint64_t disc_pawns_bb = pawns_bb & discoverers_bb;
+    while (disc_pawns_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&disc_pawns_bb);
+        const uint64_t from_bb = SQUARE_AS_BITBOARD(from_sq);
+        const uint64_t target_bb = pawn_check_bb | ~blocker_line[from_sq];
+
+        const uint64_t disc_single_bb = GEN_PUSH(from_bb) & empty_bb;
+        const uint64_t disc_single_from_start_bb = disc_single_bb & GEN_DOUBLE_PUSH_BB;
+        const uint64_t disc_double_bb = GEN_PUSH(disc_single_from_start_bb) & empty_bb;
+
+        mv_gen_encode_pawn_quiet(disc_double_bb & target_bb, 2 * GEN_PUSH_DELTA, true, mvl);
+        mv_gen_encode_pawn_quiet(disc_single_bb & target_bb, GEN_PUSH_DELTA, false, mvl);
+    }
+}
+
+/**
+ * @brief Generates quiet moves that give direct or discovered check
+ *
+ * @param pos           the game position
+ * @param mvl           the move list
+ */
+static void GEN_FN(mv_gen_quiet_checks)(const struct position *const pos, struct move_list *const mvl) {
+    const struct board *const brd = pos_get_board(pos);
+    const enum square opp_king_sq = brd_get_king_square(brd, GEN_THEM);
+
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t empty_bb = ~occupied_sq_bb;
+
+    // squares from which each piece type attacks the opposing King
+    const uint64_t knight_check_bb = occ_mask_get_knight(opp_king_sq);
+    const uint64_t bishop_check_bb = occ_mask_get_bishop_attacks(opp_king_sq, occupied_sq_bb);
+    const uint64_t rook_check_bb = occ_mask_get_rook_attacks(opp_king_sq, occupied_sq_bb);
+    const uint64_t pawn_check_bb = GEN_PAWNS_ATTACKING_SQ(opp_king_sq);
+
+    uint64_t blocker_line[NUM_SQUARES];
+    const uint64_t discoverers_bb = get_discovered_check_blockers(brd, GEN_US, opp_king_sq, blocker_line);
+
+    GEN_FN(mv_gen_pawn_quiet_checks)(brd, mvl, pawn_check_bb, discoverers_bb, blocker_line);
+
+    uint64_t knight_bb = brd_get_bb_for_role_colour(brd, KNIGHT, GEN_US);
+    while (knight_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&knight_bb);
+        const uint64_t quiet_bb = occ_mask_get_knight(from_sq) & empty_bb;
+        // a Knight can't stay on the line it's blocking, so every move discovers check
+        const bool is_discoverer = (discoverers_bb & SQUARE_AS_BITBOARD(from_sq)) != 0;
+        mv_gen_encode_multiple_quiet(is_discoverer ? quiet_bb : quiet_bb & knight_check_bb, from_sq, mvl);
+    }
+
+    const struct slider_check_masks slider_masks = {
+        .occupied = occupied_sq_bb,
+        .discoverers = discoverers_bb,
+        .blocker_line = blocker_line,
+    };
+    mv_gen_slider_quiet_checks(brd_get_bb_for_role_colour(brd, BISHOP, GEN_US), true, false, bishop_check_bb,
+                               &slider_masks, mvl);
+    mv_gen_slider_quiet_checks(brd_get_bb_for_role_colour(brd, ROOK, GEN_US), false, true, rook_check_bb,
+                               &slider_masks, mvl);
+    mv_gen_slider_quiet_checks(brd_get_bb_for_role_colour(brd, QUEEN, GEN_US), true, true,
+                               bishop_check_bb | rook_check_bb, &slider_masks, mvl);
+
+    const enum square king_sq = brd_get_king_square(brd, GEN_US);
+    if ((discoverers_bb & SQUARE_AS_BITBOARD(king_sq)) != 0) {
+        const uint64_t quiet_bb = occ_mask_get_king(king_sq) & empty_bb & ~blocker_line[king_sq];
+        mv_gen_encode_multiple_quiet(quiet_bb, king_sq, mvl);
+    }
+}
+
+/**
+ * @brief Counts the pawn moves, excluding en passant, for a set of pawns
+ *
+ * @param pawns_bb      the pawns to move
+ * @param empty_bb      bitboard of empty squares
+ * @param target_bb     bitboard of allowed target squares
+ * @param capture_bb    bitboard of allowed capture squares
+ * @return the number of moves, with each promotion counted as 4 moves
+ */
+static uint32_t GEN_FN(count_pawn_moves)(const uint64_t pawns_bb, const uint64_t empty_bb, const uint64_t target_bb,
+                                         const uint64_t capture_bb) {
+    const uint64_t promo_pawns_bb = pawns_bb & GEN_PROMO_FROM_BB;
+    const uint64_t non_promo_pawns_bb = pawns_bb & ~GEN_PROMO_FROM_BB;
+
+    const uint64_t all_single_bb = GEN_PUSH(non_promo_pawns_bb) & empty_bb;
+    const uint64_t single_from_start_bb = all_single_bb & GEN_DOUBLE_PUSH_BB;
+    const uint64_t double_bb = GEN_PUSH(single_from_start_bb) & empty_bb & target_bb;
+    const uint64_t single_bb = all_single_bb & target_bb;
+    const uint64_t promo_bb = GEN_PUSH(promo_pawns_bb) & empty_bb & target_bb;
+
+    const uint64_t capt_east_bb = GEN_CAPT_EAST(non_promo_pawns_bb) & capture_bb;
+    const uint64_t capt_west_bb = GEN_CAPT_WEST(non_promo_pawns_bb) & capture_bb;
+    const uint64_t promo_capt_east_bb = GEN_CAPT_EAST(promo_pawns_bb) & capture_bb;
+    const uint64_t promo_capt_west_bb = GEN_CAPT_WEST(promo_pawns_bb) & capture_bb;
+
+    return count_bits(double_bb) + count_bits(single_bb) + count_bits(capt_east_bb) + count_bits(capt_west_bb) +
+           4 * (count_bits(promo_bb) + count_bits(promo_capt_east_bb) + count_bits(promo_capt_west_bb));
+}
+
+/**
+ * @brief Counts the legal moves without generating them
+ *
+ * @param pos           the game position
+ * @param masks         the check and pin masks for the position
+ * @return the number of legal moves
+ */
+static uint16_t GEN_FN(mv_gen_count_legal)(const struct position *const pos,
+                                           const struct legal_move_masks *const masks) {
+    const struct board *const brd = pos_get_board(pos);
+
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t empty_bb = ~occupied_sq_bb;
+    const uint64_t not_ours_bb = ~brd_get_colour_bb(brd, GEN_US);
+
+    uint32_t count = count_bits(occ_mask_get_king(masks->king_sq) & not_ours_bb & ~masks->king_danger);
+
+    if (masks->checkers == 0) {
+        const struct cast_perm_container cp = pos_get_cast_perm(pos);
+        if (GEN_HAS_CASTLE_PERM_K(cp) && (occupied_sq_bb & GEN_CASTLE_MASK_K) == 0 &&
+            (masks->king_danger & GEN_CASTLE_MASK_K) == 0) {
+            count++;
+        }
+        if (GEN_HAS_CASTLE_PERM_Q(cp) && (occupied_sq_bb & GEN_CASTLE_MASK_Q) == 0 &&
+            (masks->king_danger & GEN_CASTLE_PATH_Q) == 0) {
+            count++;
+        }
+    }
+
+    const bool is_double_check = (masks->checkers & (masks->checkers - 1)) != 0;
+    if (is_double_check) {
+        return (uint16_t)count;
+    }
+
+    const uint64_t target_bb = masks->check_evasion & not_ours_bb;
+    const uint64_t capture_bb = target_bb & brd_get_colour_bb(brd, GEN_THEM);
+
+    // a pinned Knight can never move
+    uint64_t knight_bb = brd_get_bb_for_role_colour(brd, KNIGHT, GEN_US) & ~masks->pinned;
+    while (knight_bb != 0) {
+        count += count_bits(occ_mask_get_knight(bb_pop_1st_bit_and_clear(&knight_bb)) & target_bb);
+    }
+
+    const uint64_t queen_bb = brd_get_bb_for_role_colour(brd, QUEEN, GEN_US);
+    uint64_t diagonal_bb = brd_get_bb_for_role_colour(brd, BISHOP, GEN_US) | queen_bb;
+    while (diagonal_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&diagonal_bb);
+        const uint64_t allowed_bb = bb_is_set(masks->pinned, from_sq) ? masks->pin_ray[from_sq] : ALL_SQUARES_BB;
+        count += count_bits(occ_mask_get_bishop_attacks(from_sq, occupied_sq_bb) & target_bb & allowed_bb);
+    }
+
+    uint64_t rank_file_bb = brd_get_bb_for_role_colour(brd, ROOK, GEN_US) | queen_bb;
+    while (rank_file_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&rank_file_bb);
+        const uint64_t allowed_bb = bb_is_set(masks->pinned, from_sq) ? masks->pin_ray[from_sq] : ALL_SQUARES_BB;
+        count += count_bits(occ_mask_get_rook_attacks(from_sq, occupied_sq_bb) & target_bb & allowed_bb);
+    }
+
+    // unpinned pawns set-wise, pinned pawns one at a time
+    const uint64_t pawns_bb = brd_get_piece_bb(brd, GEN_PAWN);
+    count += GEN_FN(count_pawn_moves)(pawns_bb & ~masks->pinned, empty_bb, target_bb, capture_bb);
+
+    uint64_t pinned_pawns_bb = pawns_bb & masks->pinned;
+    while (pinned_pawns_bb != 0) {
+        const enum square from_sq = bb_pop_1st_bit_and_clear(&pinned_pawns_bb);
+        const uint64_t pin_ray_bb = masks->pin_ray[from_sq];
+        count += GEN_FN(count_pawn_moves)(SQUARE_AS_BITBOARD(from_sq), empty_bb, target_bb & pin_ray_bb,
+                                          capture_bb & pin_ray_bb);
+    }
+
+    if (pos_is_en_passant_active(pos)) {
+        const enum square en_pass_sq = pos_get_en_pass_sq(pos);
+        uint64_t att_enp_pawn_bb = pawns_bb & GEN_PAWNS_ATTACKING_SQ(en_pass_sq);
+        while (att_enp_pawn_bb != 0) {
+            const enum square from_sq = bb_pop_1st_bit_and_clear(&att_enp_pawn_bb);
+            if (is_en_passant_legal(pos, masks, from_sq, en_pass_sq)) {
+                count++;
+            }
+        }
+    }
+
+    return (uint16_t)count;
+}
+
+#undef GEN_US
+#undef GEN_THEM
+#undef GEN_PAWN
+#undef GEN_PUSH
+#undef GEN_PUSH_BACK
+#undef GEN_CAPT_EAST
+#undef GEN_CAPT_WEST
+#undef GEN_PUSH_DELTA
+#undef GEN_CAPT_EAST_DELTA
+#undef GEN_CAPT_WEST_DELTA
+#undef GEN_PROMO_FROM_BB
+#undef GEN_DOUBLE_PUSH_BB
+#undef GEN_CASTLE_MASK_K
+#undef GEN_CASTLE_MASK_Q
+#undef GEN_CASTLE_PATH_Q
+#undef GEN_HAS_CASTLE_PERM
+#undef GEN_HAS_CASTLE_PERM_K
+#undef GEN_HAS_CASTLE_PERM_Q
+#undef GEN_ENCODE_CASTLE_K
+#undef GEN_ENCODE_CASTLE_Q
+#undef GEN_PAWNS_ATTACKING_SQ
+#undef GEN_FN
+#undef GEN_IS_WHITE
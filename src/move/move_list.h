@@ -28,7 +28,8 @@
 #include "move.h"
 #include <stdint.h>
 
-#define MOVE_LIST_MAX_LEN 2048
+// the maximum number of legal moves in any chess position is 218
+#define MOVE_LIST_MAX_LEN 256
 
 // struct representing a list of moves
 struct move_list {
@@ -0,0 +1,298 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+/*! @addtogroup MovePicker
+ *
+ * @ingroup MovePicker
+ * @{
+ * @details A staged, lazy move picker for use in search.
+ *
+ * Moves are returned in the following order :
+ *  - the Transposition Table move
+ *  - good captures, ordered by MVV-LVA
+ *  - killer moves
+ *  - quiet moves
+ *  - bad captures (captures that lose material, using Static Exchange Evaluation)
+ *
+ * Each stage only generates its moves once the previous stage is exhausted, so a node that
+ * has a beta cut-off on the TT move or a capture never generates the quiet moves.
+ *
+ * When the side to move is in check, the TT move is followed by a single stage of check
+ * evasions, rather than the captures, killers and quiet moves.
+ *
+ * The moves returned are pseudo-legal, so the caller still needs to test the move is legal
+ * when making it.
+ *
+ */
+
+#include "move_picker.h"
+#include "board.h"
+#include "move.h"
+#include "move_gen.h"
+#include "move_list.h"
+#include "piece.h"
+#include "position.h"
+#include "see.h"
+#include "utils.h"
+#include <assert.h>
+
+static void score_captures(struct move_picker *const mp);
+static bool pick_best_capture(struct move_picker *const mp, struct move *const mv, bool *const is_good);
+static bool is_tt_or_killer_move(const struct move_picker *const mp, struct move mv);
+
+// Least Valuable Attacker ordering, used to break ties between captures of the same victim
+// clang-format off
+static const int32_t LVA_ORDER[NUM_PIECE_ROLES] = {
+    [PAWN]      = 0,
+    [KNIGHT]    = 1,
+    [BISHOP]    = 2,
+    [ROOK]      = 3,
+    [QUEEN]     = 4,
+    [KING]      = 5,
+};
+// clang-format on
+
+// ==================================================================
+//
+// public functions
+//
+// ==================================================================
+
+/**
+ * @brief           Initialises a move picker for the given position
+ *
+ * @param mp        The move picker
+ * @param pos       The position
+ * @param tt_move   The move from the Transposition Table, or move_get_no_move() if there isn't one
+ * @param killers   Array of MOVE_PICKER_NUM_KILLERS killer moves, or NULL. Unused entries should be move_get_no_move()
+ */
+void mv_pick_init(struct move_picker *const mp, const struct position *const pos, struct move tt_move,
+                  const struct move *const killers) {
+    assert(validate_position(pos));
+
+    mp->pos = pos;
+    mp->stage = MP_STAGE_TT_MOVE;
+    mp->tt_move = tt_move;
+    for (int i = 0; i < MOVE_PICKER_NUM_KILLERS; i++) {
+        mp->killers[i] = killers != NULL ? killers[i] : move_get_no_move();
+    }
+    mp->killer_idx = 0;
+    mp->next_idx = 0;
+    mp->end_idx = 0;
+    mp->num_bad_captures = 0;
+    mp->mvl = mvl_initialise();
+}
+
+/**
+ * @brief           Returns the next move
+ *
+ * @param mp        The move picker
+ * @param mv        Populated with the next move
+ * @return true if a move was returned, false if there are no more moves
+ */
+bool mv_pick_next(struct move_picker *const mp, struct move *const mv) {
+    const struct move no_move = move_get_no_move();
+
+    switch (mp->stage) {
+    case MP_STAGE_TT_MOVE:
+        mp->stage = pos_is_in_check(mp->pos) ? MP_STAGE_GEN_EVASIONS : MP_STAGE_GEN_CAPTURES;
+        if (!move_compare(mp->tt_move, no_move) && pos_is_pseudo_legal(mp->pos, mp->tt_move)) {
+            *mv = mp->tt_move;
+            return true;
+        }
+        return mv_pick_next(mp, mv);
+
+    case MP_STAGE_GEN_CAPTURES:
+        mv_gen_only_capture_moves(mp->pos, &mp->mvl);
+        mp->next_idx = 0;
+        mp->end_idx = mp->mvl.move_count;
+        score_captures(mp);
+        mp->stage = MP_STAGE_GOOD_CAPTURES;
+        return mv_pick_next(mp, mv);
+
+    case MP_STAGE_GOOD_CAPTURES: {
+        bool is_good;
+        while (pick_best_capture(mp, mv, &is_good)) {
+            if (!is_good) {
+                // defer until after the quiet moves
+                mp->mvl.move_list[mp->num_bad_captures] = *mv;
+                mp->num_bad_captures++;
+                continue;
+            }
+            if (!move_compare(*mv, mp->tt_move)) {
+                return true;
+            }
+        }
+        mp->stage = MP_STAGE_KILLERS;
+        return mv_pick_next(mp, mv);
+    }
+
+    case MP_STAGE_KILLERS:
+        while (mp->killer_idx < MOVE_PICKER_NUM_KILLERS) {
+            const struct move killer = mp->killers[mp->killer_idx];
+            mp->killer_idx++;
+
+            if (move_compare(killer, no_move) || move_compare(killer, mp->tt_move) || move_is_capture(killer)) {
+                continue;
+            }
+            if (pos_is_pseudo_legal(mp->pos, killer)) {
+                *mv = killer;
+                return true;
+            }
+        }
+        mp->stage = MP_STAGE_GEN_QUIETS;
+        return mv_pick_next(mp, mv);
+
+    case MP_STAGE_GEN_QUIETS:
+        // append after the captures, so the bad captures at the start of the list are preserved
+        mp->next_idx = mp->mvl.move_count;
+        mv_gen_quiet_moves(mp->pos, &mp->mvl);
+        mp->end_idx = mp->mvl.move_count;
+        mp->stage = MP_STAGE_QUIETS;
+        return mv_pick_next(mp, mv);
+
+    case MP_STAGE_QUIETS:
+        while (mp->next_idx < mp->end_idx) {
+            *mv = mp->mvl.move_list[mp->next_idx];
+            mp->next_idx++;
+            if (!is_tt_or_killer_move(mp, *mv)) {
+                return true;
+            }
+        }
+        mp->next_idx = 0;
+        mp->end_idx = mp->num_bad_captures;
+        mp->stage = MP_STAGE_BAD_CAPTURES;
+        return mv_pick_next(mp, mv);
+
+    case MP_STAGE_BAD_CAPTURES:
+        while (mp->next_idx < mp->end_idx) {
+            *mv = mp->mvl.move_list[mp->next_idx];
+            mp->next_idx++;
+            if (!move_compare(*mv, mp->tt_move)) {
+                return true;
+            }
+        }
+        mp->stage = MP_STAGE_DONE;
+        return false;
+
+    case MP_STAGE_GEN_EVASIONS:
+        mv_gen_evasion_moves(mp->pos, &mp->mvl);
+        mp->next_idx = 0;
+        mp->end_idx = mp->mvl.move_count;
+        mp->stage = MP_STAGE_EVASIONS;
+        return mv_pick_next(mp, mv);
+
+    case MP_STAGE_EVASIONS:
+        while (mp->next_idx < mp->end_idx) {
+            *mv = mp->mvl.move_list[mp->next_idx];
+            mp->next_idx++;
+            if (!move_compare(*mv, mp->tt_move)) {
+                return true;
+            }
+        }
+        mp->stage = MP_STAGE_DONE;
+        return false;
+
+    case MP_STAGE_DONE:
+        return false;
+
+    default:
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid move picker stage");
+        break;
+    }
+    return false;
+}
+
+/**
+ * @brief           Returns the current stage of the move picker
+ *
+ * @param mp        The move picker
+ * @return The current stage
+ */
+enum move_picker_stage mv_pick_get_stage(const struct move_picker *const mp) {
+    return mp->stage;
+}
+
+// ==================================================================
+//
+// private functions
+//
+// ==================================================================
+
+static void score_captures(struct move_picker *const mp) {
+    const struct board *const brd = pos_get_board(mp->pos);
+
+    for (uint16_t i = mp->next_idx; i < mp->end_idx; i++) {
+        const struct move mv = mp->mvl.move_list[i];
+
+        enum piece attacker;
+        brd_try_get_piece_on_square(brd, move_decode_from_sq(mv), &attacker);
+
+        // en passant target square is empty, the victim is always a pawn
+        Score victim_value = pce_get_value(WHITE_PAWN);
+        enum piece victim;
+        if (brd_try_get_piece_on_square(brd, move_decode_to_sq(mv), &victim)) {
+            victim_value = pce_get_value(victim);
+        }
+
+        // Most Valuable Victim, then Least Valuable Attacker
+        mp->scores[i] = (victim_value * NUM_PIECE_ROLES) - LVA_ORDER[pce_get_role(attacker)];
+    }
+}
+
+static bool pick_best_capture(struct move_picker *const mp, struct move *const mv, bool *const is_good) {
+    if (mp->next_idx >= mp->end_idx) {
+        return false;
+    }
+
+    // selection sort, one move at a time, as a cut-off usually happens before all captures are used
+    uint16_t best_idx = mp->next_idx;
+    for (uint16_t i = (uint16_t)(mp->next_idx + 1); i < mp->end_idx; i++) {
+        if (mp->scores[i] > mp->scores[best_idx]) {
+            best_idx = i;
+        }
+    }
+
+    *mv = mp->mvl.move_list[best_idx];
+    mp->mvl.move_list[best_idx] = mp->mvl.move_list[mp->next_idx];
+    mp->scores[best_idx] = mp->scores[mp->next_idx];
+    mp->next_idx++;
+
+    *is_good = see_ge(mp->pos, *mv, 0);
+    return true;
+}
+
+static bool is_tt_or_killer_move(const struct move_picker *const mp, struct move mv) {
+    if (move_compare(mv, mp->tt_move)) {
+        return true;
+    }
+    for (int i = 0; i < MOVE_PICKER_NUM_KILLERS; i++) {
+        if (move_compare(mv, mp->killers[i])) {
+            return true;
+        }
+    }
+    return false;
+}
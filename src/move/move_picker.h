@@ -0,0 +1,75 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "move.h"
+#include "move_list.h"
+#include "position.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MOVE_PICKER_NUM_KILLERS (2)
+
+// clang-format off
+enum move_picker_stage {
+    MP_STAGE_TT_MOVE,
+    MP_STAGE_GEN_CAPTURES,
+    MP_STAGE_GOOD_CAPTURES,
+    MP_STAGE_KILLERS,
+    MP_STAGE_GEN_QUIETS,
+    MP_STAGE_QUIETS,
+    MP_STAGE_BAD_CAPTURES,
+    MP_STAGE_GEN_EVASIONS,
+    MP_STAGE_EVASIONS,
+    MP_STAGE_DONE,
+};
+// clang-format on
+
+// Staged move picker state. Create on the stack for each node using mv_pick_init(), and
+// treat the contents as private.
+struct move_picker {
+    const struct position *pos;
+    enum move_picker_stage stage;
+
+    struct move tt_move;
+    struct move killers[MOVE_PICKER_NUM_KILLERS];
+    uint8_t killer_idx;
+
+    // moves for the current stage are in [next_idx, end_idx) of the move list. Bad captures
+    // are moved to the start of the list, in [0, num_bad_captures)
+    uint16_t next_idx;
+    uint16_t end_idx;
+    uint16_t num_bad_captures;
+
+    int32_t scores[MOVE_LIST_MAX_LEN];
+    struct move_list mvl;
+};
+
+void mv_pick_init(struct move_picker *const mp, const struct position *const pos, struct move tt_move,
+                  const struct move *const killers);
+bool mv_pick_next(struct move_picker *const mp, struct move *const mv);
+enum move_picker_stage mv_pick_get_stage(const struct move_picker *const mp);
@@ -0,0 +1,146 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+/*! @addtogroup MoveStack
+ *
+ * @ingroup MoveStack
+ * @{
+ * @details A preallocated stack of move lists, one per ply.
+ *
+ * Recursive code (perft, search) pushes a move list when entering a node and pops it when
+ * leaving, rather than declaring a move list on the C stack at each level. The lists are
+ * allocated once, contiguously, when the stack is created. Each thread should own its own
+ * move stack.
+ *
+ */
+
+#include "move_stack.h"
+#include "move_list.h"
+#include "utils.h"
+#include <assert.h>
+#include <stdlib.h>
+
+// key used to verify struct has been initialised
+#define MOVE_STACK_INIT_KEY (0xbeef)
+
+struct move_stack {
+    uint16_t struct_init_key;
+    // number of lists in use
+    uint16_t depth;
+    struct move_list lists[MOVE_STACK_MAX_DEPTH];
+};
+
+// ==================================================================
+//
+// public functions
+//
+// ==================================================================
+
+/**
+ * @brief       Allocates and initialises a new, empty, move stack
+ *
+ * @return      The move stack
+ */
+struct move_stack *mvs_create(void) {
+    struct move_stack *mvs = (struct move_stack *)malloc(sizeof(struct move_stack));
+    if (mvs == NULL) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Failed to allocate move stack");
+    }
+
+    mvs->struct_init_key = MOVE_STACK_INIT_KEY;
+    mvs->depth = 0;
+    return mvs;
+}
+
+/**
+ * @brief       Frees the move stack
+ *
+ * @param mvs   The move stack
+ */
+void mvs_destroy(struct move_stack *mvs) {
+    assert(validate_move_stack(mvs));
+
+    free(mvs);
+}
+
+/**
+ * @brief       Pushes a new, empty, move list on to the stack
+ *
+ * @param mvs   The move stack
+ * @return      The move list for the new ply. Only valid until the matching call to mvs_pop()
+ */
+struct move_list *mvs_push(struct move_stack *const mvs) {
+    assert(validate_move_stack(mvs));
+    assert(mvs->depth < MOVE_STACK_MAX_DEPTH);
+
+    struct move_list *const mvl = &mvs->lists[mvs->depth];
+    *mvl = mvl_initialise();
+    mvs->depth++;
+
+    return mvl;
+}
+
+/**
+ * @brief       Pops the most recently pushed move list from the stack
+ *
+ * @param mvs   The move stack
+ */
+void mvs_pop(struct move_stack *const mvs) {
+    assert(validate_move_stack(mvs));
+    assert(mvs->depth > 0);
+
+    mvs->depth--;
+}
+
+/**
+ * @brief       Returns the number of move lists currently on the stack
+ *
+ * @param mvs   The move stack
+ * @return      The stack depth
+ */
+uint16_t mvs_get_depth(const struct move_stack *const mvs) {
+    assert(validate_move_stack(mvs));
+
+    return mvs->depth;
+}
+
+/**
+ * @brief       Validates the move stack
+ *
+ * @param mvs   The move stack
+ * @return      true if valid, false otherwise
+ */
+bool validate_move_stack(const struct move_stack *const mvs) {
+    if (mvs->struct_init_key != MOVE_STACK_INIT_KEY) {
+        assert(false);
+    }
+
+    if (mvs->depth > MOVE_STACK_MAX_DEPTH) {
+        assert(false);
+    }
+
+    return true;
+}
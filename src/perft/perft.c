@@ -34,6 +34,7 @@
 
 #include "perft.h"
 #include "move_gen.h"
+#include "move_stack.h"
 #include "perft_file_reader.h"
 #include "position.h"
 #include "utils.h"
@@ -43,27 +44,45 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+static uint64_t perft(const uint8_t depth, struct position *pos, struct move_stack *const mvs);
+
+/**
+ * @brief           Counts the leaf nodes of the move tree for the given position and depth
+ *
+ * @param depth     The depth to search
+ * @param pos       The position
+ * @return The number of leaf nodes
+ */
 uint64_t do_perft(const uint8_t depth, struct position *pos) {
+    struct move_stack *mvs = mvs_create();
+
+    const uint64_t nodes = perft(depth, pos, mvs);
+
+    mvs_destroy(mvs);
+    return nodes;
+}
+
+static uint64_t perft(const uint8_t depth, struct position *pos, struct move_stack *const mvs) {
     if (depth == 0) {
         return 1;
     }
+    if (depth == 1) {
+        // bulk count at the frontier, no need to make each move
+        return mv_gen_count_legal_moves(pos);
+    }
 
     uint64_t nodes = 0;
-    struct move_list mvl = mvl_initialise();
-
-    mv_gen_all_moves(pos, &mvl);
-
-    //printf("generated move cnt %d\n", mvl.move_count);
+    struct move_list *const mvl = mvs_push(mvs);
 
-    for (int i = 0; i < mvl.move_count; i++) {
-        const struct move mv = mvl.move_list[i];
-        const enum move_legality legality = pos_make_move(pos, mv);
+    mv_gen_legal_moves(pos, mvl);
 
-        if (legality == LEGAL_MOVE) {
-            nodes += do_perft(depth - 1, pos);
-        }
+    for (int i = 0; i < mvl->move_count; i++) {
+        const struct move mv = mvl->move_list[i];
+        pos_make_legal_move(pos, mv);
+        nodes += perft(depth - 1, pos, mvs);
         pos_take_move(pos);
     }
 
+    mvs_pop(mvs);
     return nodes;
 }
@@ -37,16 +37,67 @@
 #include "board.h"
 #include "occupancy_mask.h"
 #include "square.h"
-#include "utils.h"
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
 
-static bool is_white_attacking(const struct position *const pos, enum square sq);
-static bool is_black_attacking(const struct position *const pos, enum square sq);
-static bool is_horizontal_or_vertical_attacking(uint64_t all_pce_bb, uint64_t attacking_pce_bb, enum square sq);
-static bool is_diagonally_attacked(uint64_t all_pce_bb, uint64_t attacking_pce_bb, enum square sq);
-static bool is_knight_attacking(uint64_t knight_bb, enum square sq);
+static void build_colour_attacks(const struct board *const brd, enum colour side, uint64_t occupied,
+                                 struct attack_map *const map);
+static uint64_t get_knight_attacks(uint64_t knight_bb);
+static uint64_t get_bishop_attacks(uint64_t bishop_bb, uint64_t occupied);
+static uint64_t get_rook_attacks(uint64_t rook_bb, uint64_t occupied);
+
+/**
+ * @brief Builds the squares attacked by each piece role of both sides
+ * @details Pawn attacks are calculated set-wise, the other pieces use the attack tables. Intended to be
+ * built once per node and shared by evaluation terms, see pos_get_attack_map().
+ *
+ * @param pos The position
+ * @param map Populated with the attack bitboards
+ */
+void att_chk_build_attack_map(const struct position *const pos, struct attack_map *const map) {
+    assert(validate_position(pos));
+
+    const struct board *const brd = pos_get_board(pos);
+    const uint64_t occupied = brd_get_board_bb(brd);
+
+    build_colour_attacks(brd, WHITE, occupied, map);
+    build_colour_attacks(brd, BLACK, occupied, map);
+}
+
+/**
+ * @brief Returns all pieces, of both colours, attacking the given square
+ * @details Uses direct attack lookups, so the cost doesn't depend on the number of pieces. Sliders are blocked
+ * by the given occupancy rather than the board, which allows for pieces that have moved or been captured (eg,
+ * when testing a move, or for x-ray attackers in an exchange).
+ *
+ * @param pos The position
+ * @param sq The square
+ * @param occupied The occupied squares
+ * @return Bitboard of the attacking pieces
+ */
+uint64_t att_chk_attackers_to(const struct position *const pos, enum square sq, uint64_t occupied) {
+    assert(validate_position(pos));
+    assert(validate_square(sq));
+
+    const struct board *const brd = pos_get_board(pos);
+
+    // conflate rook and queen, and bishop and queen
+    const uint64_t queen_bb = brd_get_piece_bb(brd, WHITE_QUEEN) | brd_get_piece_bb(brd, BLACK_QUEEN);
+    const uint64_t rook_queen_bb = brd_get_piece_bb(brd, WHITE_ROOK) | brd_get_piece_bb(brd, BLACK_ROOK) | queen_bb;
+    const uint64_t bishop_queen_bb =
+        brd_get_piece_bb(brd, WHITE_BISHOP) | brd_get_piece_bb(brd, BLACK_BISHOP) | queen_bb;
+    const uint64_t knight_bb = brd_get_piece_bb(brd, WHITE_KNIGHT) | brd_get_piece_bb(brd, BLACK_KNIGHT);
+    const uint64_t king_bb = brd_get_piece_bb(brd, WHITE_KING) | brd_get_piece_bb(brd, BLACK_KING);
+
+    // a piece on 'sq' would attack the same squares that can attack 'sq', the pawn masks are the squares
+    // a pawn attacks 'sq' from
+    return (occ_mask_get_bb_white_pawns_attacking_sq(sq) & brd_get_piece_bb(brd, WHITE_PAWN)) |
+           (occ_mask_get_bb_black_pawns_attacking_sq(sq) & brd_get_piece_bb(brd, BLACK_PAWN)) |
+           (occ_mask_get_knight(sq) & knight_bb) | (occ_mask_get_king(sq) & king_bb) |
+           (occ_mask_get_rook_attacks(sq, occupied) & rook_queen_bb) |
+           (occ_mask_get_bishop_attacks(sq, occupied) & bishop_queen_bb);
+}
 
 /**
  * @brief Tests if a the given square is being attacked by the given colour
@@ -63,148 +114,53 @@ bool att_chk_is_sq_attacked(const struct position *const pos, enum square sq, en
     assert(validate_square(sq));
     assert(validate_colour(attacking_side));
 
-    switch (attacking_side) {
-    case WHITE:
-        return is_white_attacking(pos, sq);
-    case BLACK:
-        return is_black_attacking(pos, sq);
-    default:
-        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid attacking side");
-        break;
-    }
-}
-
-static bool is_white_attacking(const struct position *const pos, enum square sq) {
     const struct board *const brd = pos_get_board(pos);
-    const uint64_t all_pce_bb = brd_get_board_bb(brd);
-
-    // conflate rook and queen
-    const uint64_t rook_queen_bb =
-        brd_get_bb_for_role_colour(brd, ROOK, WHITE) | brd_get_bb_for_role_colour(brd, QUEEN, WHITE);
+    const uint64_t attackers_bb = att_chk_attackers_to(pos, sq, brd_get_board_bb(brd));
 
-    if (is_horizontal_or_vertical_attacking(all_pce_bb, rook_queen_bb, sq)) {
-        return true;
-    }
-
-    // conflate bishop and queen
-    const uint64_t bishop_queen_bb =
-        brd_get_bb_for_role_colour(brd, BISHOP, WHITE) | brd_get_bb_for_role_colour(brd, QUEEN, WHITE);
-
-    if (is_diagonally_attacked(all_pce_bb, bishop_queen_bb, sq)) {
-        return true;
-    }
-
-    const uint64_t knight_bb = brd_get_piece_bb(brd, WHITE_KNIGHT);
-    if (is_knight_attacking(knight_bb, sq)) {
-        return true;
-    }
-
-    const uint64_t wp_bb = brd_get_piece_bb(brd, WHITE_PAWN);
-    const uint64_t attacking_bb = occ_mask_get_bb_white_pawns_attacking_sq(sq);
-    if ((attacking_bb & wp_bb) != 0) {
-        return true;
-    }
-
-    const enum square king_sq = brd_get_king_square(brd, WHITE);
-    const uint64_t occ_mask = occ_mask_get_king(king_sq);
-    if (bb_is_set(occ_mask, sq)) {
-        return true;
-    }
-
-    return false;
+    return (attackers_bb & brd_get_colour_bb(brd, attacking_side)) != 0;
 }
 
-static bool is_black_attacking(const struct position *const pos, enum square sq) {
-    const struct board *const brd = pos_get_board(pos);
-    const uint64_t all_pce_bb = brd_get_board_bb(brd);
-
-    // conflate rook and queen
-    const uint64_t rook_queen_bb =
-        brd_get_bb_for_role_colour(brd, ROOK, BLACK) | brd_get_bb_for_role_colour(brd, QUEEN, BLACK);
-    if (is_horizontal_or_vertical_attacking(all_pce_bb, rook_queen_bb, sq)) {
-        return true;
-    }
+static void build_colour_attacks(const struct board *const brd, enum colour side, uint64_t occupied,
+                                 struct attack_map *const map) {
+    uint64_t *const by_role = map->by_role[side];
 
-    // conflate bishop and queen
-    const uint64_t bishop_queen_bb =
-        brd_get_bb_for_role_colour(brd, BISHOP, BLACK) | brd_get_bb_for_role_colour(brd, QUEEN, BLACK);
-    if (is_diagonally_attacked(all_pce_bb, bishop_queen_bb, sq)) {
-        return true;
-    }
+    const uint64_t pawn_bb = brd_get_bb_for_role_colour(brd, PAWN, side);
+    by_role[PAWN] = side == WHITE ? (NORTH_EAST(pawn_bb) | NORTH_WEST(pawn_bb))
+                                  : (SOUTH_EAST(pawn_bb) | SOUTH_WEST(pawn_bb));
 
-    const uint64_t knight_bb = brd_get_piece_bb(brd, BLACK_KNIGHT);
-    if (is_knight_attacking(knight_bb, sq)) {
-        return true;
-    }
+    by_role[KNIGHT] = get_knight_attacks(brd_get_bb_for_role_colour(brd, KNIGHT, side));
+    by_role[BISHOP] = get_bishop_attacks(brd_get_bb_for_role_colour(brd, BISHOP, side), occupied);
+    by_role[ROOK] = get_rook_attacks(brd_get_bb_for_role_colour(brd, ROOK, side), occupied);
 
-    const uint64_t bp_bb = brd_get_piece_bb(brd, BLACK_PAWN);
-    const uint64_t attacking_bb = occ_mask_get_bb_black_pawns_attacking_sq(sq);
-    if ((attacking_bb & bp_bb) != 0) {
-        return true;
-    }
+    const uint64_t queen_bb = brd_get_bb_for_role_colour(brd, QUEEN, side);
+    by_role[QUEEN] = get_bishop_attacks(queen_bb, occupied) | get_rook_attacks(queen_bb, occupied);
 
-    const enum square king_sq = brd_get_king_square(brd, BLACK);
-    const uint64_t occ_mask = occ_mask_get_king(king_sq);
-    if (bb_is_set(occ_mask, sq)) {
-        return true;
-    }
+    by_role[KING] = occ_mask_get_king(brd_get_king_square(brd, side));
 
-    return false;
+    map->by_colour[side] =
+        by_role[PAWN] | by_role[KNIGHT] | by_role[BISHOP] | by_role[ROOK] | by_role[QUEEN] | by_role[KING];
 }
 
-static bool is_knight_attacking(const uint64_t knight_bb, enum square sq) {
-    uint64_t bb = knight_bb;
-
-    // conflate all knight attack squares for all knights
-    uint64_t knight_attack_sq = 0;
-    while (bb != 0) {
-        const enum square pce_sq = bb_pop_1st_bit_and_clear(&bb);
-        knight_attack_sq |= occ_mask_get_knight(pce_sq);
+static uint64_t get_knight_attacks(uint64_t knight_bb) {
+    uint64_t attacked_bb = 0;
+    while (knight_bb != 0) {
+        attacked_bb |= occ_mask_get_knight(bb_pop_1st_bit_and_clear(&knight_bb));
     }
-
-    return bb_is_set(knight_attack_sq, sq);
+    return attacked_bb;
 }
 
-static bool is_horizontal_or_vertical_attacking(uint64_t all_pce_bb, uint64_t attacking_pce_bb, enum square sq) {
-    // do a quick check before evaluating each piece
-    const uint64_t sq_horiz_vert_bb = occ_mask_get_vertical(sq) | occ_mask_get_horizontal(sq);
-    if ((sq_horiz_vert_bb & attacking_pce_bb) == 0) {
-        // nothing shares rank or file with square
-        return false;
-    }
-
-    uint64_t bb = attacking_pce_bb & sq_horiz_vert_bb;
-    while (bb != 0) {
-        const enum square pce_sq = bb_pop_1st_bit_and_clear(&bb);
-        const uint64_t inter_sq = occ_mask_get_inbetween(pce_sq, sq);
-        if ((inter_sq & all_pce_bb) == 0) {
-            // no blocking pieces, is attacked
-            return true;
-        }
+static uint64_t get_bishop_attacks(uint64_t bishop_bb, uint64_t occupied) {
+    uint64_t attacked_bb = 0;
+    while (bishop_bb != 0) {
+        attacked_bb |= occ_mask_get_bishop_attacks(bb_pop_1st_bit_and_clear(&bishop_bb), occupied);
     }
-    return false;
+    return attacked_bb;
 }
 
-static bool is_diagonally_attacked(uint64_t all_pce_bb, uint64_t attacking_pce_bb, enum square sq) {
-
-    // do a quick check to see if the attacking pieces share a diagonal or anti-diagonal with
-    // the square, before checking each individual attacking piece
-    const struct diagonals diags = occ_mask_get_diagonals(sq);
-    const uint64_t diag_bb = diags.positive | diags.negative;
-    if ((diag_bb & attacking_pce_bb) == false) {
-        // nothing shares a diagonal with this square
-        return false;
-    }
-
-    // only need to check pieces that share diags with square
-    uint64_t bb = attacking_pce_bb & diag_bb;
-    while (bb != 0) {
-        const enum square pce_sq = bb_pop_1st_bit_and_clear(&bb);
-        const uint64_t intervening_sq_bb = occ_mask_get_inbetween(pce_sq, sq);
-        if ((intervening_sq_bb & all_pce_bb) == 0) {
-            // no blocking pieces, so square is attacked
-            return true;
-        }
+static uint64_t get_rook_attacks(uint64_t rook_bb, uint64_t occupied) {
+    uint64_t attacked_bb = 0;
+    while (rook_bb != 0) {
+        attacked_bb |= occ_mask_get_rook_attacks(bb_pop_1st_bit_and_clear(&rook_bb), occupied);
     }
-    return false;
+    return attacked_bb;
 }
@@ -30,5 +30,16 @@
 #include "position.h"
 #include "square.h"
 #include <stdbool.h>
+#include <stdint.h>
 
+// the squares attacked by each side, built in one pass over the board
+struct attack_map {
+    // squares attacked by each piece role, for each colour
+    uint64_t by_role[NUM_COLOURS][NUM_PIECE_ROLES];
+    // squares attacked by any piece, for each colour
+    uint64_t by_colour[NUM_COLOURS];
+};
+
+void att_chk_build_attack_map(const struct position *const pos, struct attack_map *const map);
+uint64_t att_chk_attackers_to(const struct position *const pos, enum square sq, uint64_t occupied);
 bool att_chk_is_sq_attacked(const struct position *const pos, enum square sq, enum colour attacking_side);
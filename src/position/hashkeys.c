@@ -33,54 +33,14 @@
 
 #include "hashkeys.h"
 #include "castle_perms.h"
+#include "hashkeys_tables.h"
 #include "piece.h"
-#include "rand.h"
 #include "square.h"
 #include "utils.h"
 #include <assert.h>
 
-static uint64_t piece_keys[NUM_PIECE_ROLES][NUM_COLOURS][NUM_SQUARES] = {{0}, {0}, {0}};
-static uint64_t side_key = 0;
-static uint64_t castle_keys[NUM_CASTLE_PERMS] = {0};
-static uint64_t en_passant_sq_keys[NUM_SQUARES] = {0};
-
-/**
- * @brief       Initialises the position hashkeys
- *
- */
-uint64_t init_key_mgmt(void) {
-    init_prng();
-
-    uint64_t hashkey = 0;
-
-    for (int num_roles = 0; num_roles < NUM_PIECE_ROLES; num_roles++) {
-        for (int num_cols = 0; num_cols < NUM_COLOURS; num_cols++) {
-            for (int num_sq = 0; num_sq < NUM_SQUARES; num_sq++) {
-
-                const uint64_t rnd = genrand64_int64();
-                piece_keys[num_roles][num_cols][num_sq] = rnd;
-
-                hashkey ^= rnd;
-            }
-        }
-    }
-
-    side_key = genrand64_int64();
-    hashkey ^= side_key;
-
-    for (int num_sq = 0; num_sq < NUM_SQUARES; num_sq++) {
-        en_passant_sq_keys[num_sq] = genrand64_int64();
-
-        hashkey ^= en_passant_sq_keys[num_sq];
-    }
-
-    for (int i = 0; i < NUM_CASTLE_PERMS; i++) {
-        castle_keys[i] = genrand64_int64();
-
-        hashkey ^= castle_keys[i];
-    }
-    return hashkey;
-}
+// The Zobrist keys are generated offline by tools/table_gen.py (see hashkeys_tables.h), using the
+// same seeded 64-bit Mersenne Twister sequence as rand.c, so hashes are stable between builds.
 
 uint64_t hash_piece_update(enum piece pce, enum square sq, uint64_t key_to_modify) {
     assert(validate_piece(pce));
@@ -105,7 +65,7 @@ uint64_t hash_piece_update_move(enum piece pce, enum square from_sq, enum square
     const enum colour colour = pce_get_colour(pce);
 
     uint64_t hashkey = key_to_modify ^ piece_keys[role][colour][from_sq];
-    hashkey = key_to_modify ^ piece_keys[role][colour][to_sq];
+    hashkey ^= piece_keys[role][colour][to_sq];
 
     return hashkey;
 }
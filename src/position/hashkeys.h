@@ -30,7 +30,6 @@
 #include "square.h"
 #include <stdint.h>
 
-uint64_t init_key_mgmt(void);
 bool hash_compare(uint64_t hashkey1, uint64_t hashkey2);
 uint64_t hash_piece_update(enum piece pce, enum square sq, uint64_t key_to_modify);
 uint64_t hash_piece_update_move(enum piece pce, enum square from_sq, enum square to_sq, uint64_t key_to_modify);
@@ -0,0 +1,271 @@
+/*
+ * This file is generated by tools/table_gen.py - DO NOT EDIT.
+ */
+
+#pragma once
+
+#include "castle_perms.h"
+#include "piece.h"
+#include "square.h"
+#include <stdint.h>
+
+// clang-format off
+
+static const uint64_t piece_keys[NUM_PIECE_ROLES][NUM_COLOURS][NUM_SQUARES] = {
+    {
+        {
+            0x64d79b552a559d7fULL, 0x44a572665a6ee240ULL, 0xeb2bf6dc3d72135cULL, 0xe3836981f9f82ea0ULL,
+            0x43a38212350ee392ULL, 0xce77502bffcacf8bULL, 0x5d8a82d90126f0e7ULL, 0xc0510c6f402c1e3cULL,
+            0x48d895bf8b69f77bULL, 0x8d9fbb371f1de07fULL, 0x1126b97be8c91ce2ULL, 0xf05e1c9dc2674be2ULL,
+            0xe4d5327a12874c1eULL, 0x7c1951ea43a7500dULL, 0xbba2bbfbecbc239aULL, 0xc5704350b17f0215ULL,
+            0x823a67c5f88337e7ULL, 0xd9bf140bfeb4c1a9ULL, 0x9fbe3cfcd1f08059ULL, 0xdc29309412e352b9ULL,
+            0x5a0ff7908b1b3c57ULL, 0x46f39cb43b126c55ULL, 0x9648168491f3b126ULL, 0xdd3e72538fd39a1cULL,
+            0xd65a3663fc9b0898ULL, 0x421ee7823c2af2ebULL, 0xcba3a4b69b6ed152ULL, 0x0348399b7d2b8428ULL,
+            0xbdb750bf00c34a38ULL, 0xcf36d95eae514f52ULL, 0x7b9231d5308d7534ULL, 0xb225e28cfc5aa663ULL,
+            0xa833f6d5c72448a4ULL, 0xdaa565f5815de899ULL, 0x4b051d1e4cc78eb8ULL, 0x97fcd1b4d342e575ULL,
+            0xef6a48be001729c7ULL, 0x3982f1fa31afeab8ULL, 0xfdc570ba2fe979fbULL, 0xb57697121dfdfe93ULL,
+            0x96524e209b767c29ULL, 0x55aad0ebca994043ULL, 0xb22687b88856b63eULL, 0xb313b667a4d999d6ULL,
+            0x07c7fa1bd6fd7deaULL, 0x0ee9f4c15c57e92aULL, 0xc5fb71b8f4bf5f56ULL, 0xa251f93a4b335492ULL,
+            0xb9bad7f9e5b07befULL, 0x62fc9ac35ccde7aaULL, 0x933792382b0218a3ULL, 0x7d497d2f7a15eaf8ULL,
+            0xb2f0624214f522a2ULL, 0xd9895bbb810ec3d6ULL, 0x22d91b683f251121ULL, 0xc8fe9a347247affdULL,
+            0x3462898a2ae7b001ULL, 0x468bc3a10a34890cULL, 0x84ff6ce56552b185ULL, 0xed95ff232c511188ULL,
+            0x4869be47a8137c83ULL, 0x934606951e6fcd81ULL, 0x1ab5e8e453bde710ULL, 0x6386b61b30fa1157ULL,
+        },
+        {
+            0x97f3a778e242d0cfULL, 0xd870d281b293af3dULL, 0xc3a5f903a836fafdULL, 0x088bd6a24d49cd77ULL,
+            0x4e38ddc2719162a5ULL, 0xf48286b4f22cad94ULL, 0x080f6f650c337557ULL, 0x05e6daf6aae1ad59ULL,
+            0x7450f7229f336762ULL, 0xb75b43fb4c81784aULL, 0xebd37a514f153148ULL, 0x0d4b3a39e0bc52c7ULL,
+            0x562f36fae610a2e1ULL, 0x0e0e413e555bd736ULL, 0xd452549efe08402dULL, 0xf2e2ff7be2c75e21ULL,
+            0xf2385606c18aaf0dULL, 0xdb609b507d8c6b8bULL, 0x74ac5663c6c4f45bULL, 0x0d84c9a356858060ULL,
+            0x19d5b3643bc029b6ULL, 0x0dd8131e97ffc842ULL, 0xfa7303606bfffc05ULL, 0xf98c6d63ff48a16eULL,
+            0x34df46aa2d610767ULL, 0x83490ef054537f7eULL, 0xe071f833e55ebfe6ULL, 0x0d4b94537ed4a6aaULL,
+            0x3cf85e4e333966fdULL, 0xba15364649384016ULL, 0xc0e6bd623ca72405ULL, 0xdae6e879b8eab74aULL,
+            0xe4a41f17e70d3e0aULL, 0x56e10c00dd580f70ULL, 0xa9a66bb41781d872ULL, 0x58e42dbdffe21573ULL,
+            0x69450e1ce9674e6aULL, 0x47fe345a350aa605ULL, 0xac958aa80455a5a4ULL, 0xbc1abca3fbeeb2f3ULL,
+            0x08f760d9228900a4ULL, 0x9e1eb8a2dfec4387ULL, 0xe91bd1321f5fdc89ULL, 0xda11a24c514b9dc7ULL,
+            0xb1f63d976e0e639bULL, 0x41c11098f6123861ULL, 0x3d7736979f978f68ULL, 0x0820685b38c926beULL,
+            0x0e8c3dcab075b112ULL, 0x5e37299d89089ba4ULL, 0xa1f735eb8235b32fULL, 0x2289d719e7b146eeULL,
+            0x1c9c9d0284d96719ULL, 0x5f8b358546775be8ULL, 0x317e34c009a07a39ULL, 0xb16b073eb0ee0a19ULL,
+            0x423b36fd459f2a66ULL, 0x5f45053666f3f84fULL, 0x63e7074f03c73d92ULL, 0x22080cf23288e895ULL,
+            0xba4e71bf61dac16fULL, 0x9643b3707db2cfb5ULL, 0x98e2db6c665e7178ULL, 0xcbc57de0ef3eabb6ULL,
+        },
+    },
+    {
+        {
+            0x6239a2197582a8a8ULL, 0xf2ae968e55fda13dULL, 0x36e7ac11d1f3a617ULL, 0x508f0acb609bd756ULL,
+            0x6f42d435193a1ac2ULL, 0x2df2cab9d65e0b00ULL, 0x4584c1fde5f1ad55ULL, 0x602c500bdc8317c2ULL,
+            0xc80d5b04f6337337ULL, 0x98abcf971892a773ULL, 0x5d33cf557e6c4475ULL, 0x05b5a78be74ccd40ULL,
+            0x3ec2cce5290785f4ULL, 0x2eef1e9c4b36828bULL, 0xdd274241a0ce8c55ULL, 0x3c4cb919b35c221cULL,
+            0xc1fd68d779db9923ULL, 0x7ff345b4eb7f3639ULL, 0x804d5881b2eefef3ULL, 0xa15f9c2826cb34dbULL,
+            0x64822b68adefa772ULL, 0x761e92f8d279850dULL, 0xa5d049ab1061dba3ULL, 0x5f46fb02d10d2219ULL,
+            0xc1cdaa5f9ca79b19ULL, 0xdd713a74701ebe60ULL, 0x6b626ec963951798ULL, 0x1d3ec8d78b96d16dULL,
+            0xdb885d52960e7f34ULL, 0xe39849cf3ea178f8ULL, 0xc1e37acdf807130bULL, 0x3645880ebf333913ULL,
+            0x3af81a7bec346c22ULL, 0x871c563e94324804ULL, 0xac55fb5e2817db4cULL, 0x035b04c42565ebe2ULL,
+            0x5094cafab11cbc3aULL, 0x94d40a57481346b5ULL, 0x0f91a8492df723e3ULL, 0x126a70b84f779accULL,
+            0x4409e9a5d5c3f133ULL, 0xb1655339864151efULL, 0x6564e506d11e9de1ULL, 0xd9a06f7b8860b488ULL,
+            0x0d493e410b68b6c6ULL, 0x4e6fbf4b3b985a07ULL, 0x71c1b0ba9e52a2deULL, 0x5775784ad3cb99d9ULL,
+            0xbab84cec312107a6ULL, 0xd9066f5ccd59cf9eULL, 0x8c656651dbb3ed84ULL, 0xa7448d0059484568ULL,
+            0x2819237e5e8cb03aULL, 0xd57eaf5239931b4bULL, 0x6cd436fd5f7c1e73ULL, 0xf03b845f2a584931ULL,
+            0x8847b9f1f2d55b7aULL, 0xd49a38f8e59db8faULL, 0xd5052cc47685dbfaULL, 0x91e060fb399ecf2cULL,
+            0x5748fbea12dd2869ULL, 0xd0cee85adb889226ULL, 0xa35e9dfa5a64f56aULL, 0x3118398bd0e3cbf0ULL,
+        },
+        {
+            0x5e650b9a3cb34308ULL, 0xf575ccbebf49b91cULL, 0xb3f8dd73257c80e2ULL, 0x13d7954e8294819bULL,
+            0x90b57ccd00f1591dULL, 0xa8b13ef52ca7e284ULL, 0xe482d24e5b239833ULL, 0xb0648475f2b4d63fULL,
+            0x847e8fc889e2389bULL, 0xa8b501ee1fc59ba6ULL, 0x29702f6acba4379eULL, 0xfaba9600f3d2cd0fULL,
+            0x52ed7d9f45c6b578ULL, 0xa02b167546d6e2d0ULL, 0x9a41cb166618a390ULL, 0x83d464d7349d9f3aULL,
+            0x805485c9d2c70c6cULL, 0x332f7ce3e077ecceULL, 0x1ead372c068ebb04ULL, 0xd6866c5b3b5eb82cULL,
+            0x5b057c64bda94a33ULL, 0x11e1388f59653c66ULL, 0xffd2aca771c0abb8ULL, 0x2fabdd0e8e8ba606ULL,
+            0xe974ffd57219e5e6ULL, 0x2b4e5c1e5f98e506ULL, 0xe7819b2cb44db4c0ULL, 0x6cbd78c408376520ULL,
+            0x244285f39307f083ULL, 0xd152927f3a3af853ULL, 0x5b799885a8ba66e3ULL, 0x9300da64ea1a0644ULL,
+            0x67399bf8688a0cabULL, 0x047c301af4a94bb2ULL, 0x6750ecdf35c8471bULL, 0x7598ae5c876d4080ULL,
+            0x269e0cf307467534ULL, 0x2ef4d8dcaedbc549ULL, 0x2c6983c911c958afULL, 0xb2fd7c07ae0bfa60ULL,
+            0x3220a56d67450e80ULL, 0x7385883420eb9f69ULL, 0xdb1fd2951f15b047ULL, 0x0f08b35df55977bcULL,
+            0x42939b9f2e58127eULL, 0x4d1d77e72414aa9aULL, 0xfd8137f8b59bd084ULL, 0x167cc7f46a511504ULL,
+            0x0263de0c6b50290dULL, 0x2a1c2feb488ffab8ULL, 0x1194815038360d85ULL, 0x36374630d0ecb4e8ULL,
+            0x609d38e22c59a974ULL, 0xee23867f7c9b5f54ULL, 0x40e53a7804b0ef15ULL, 0x8f287f1a3be6e458ULL,
+            0xba7334b0f0af9e75ULL, 0x09f003e8e0e9c6c0ULL, 0xc02dd0d35c42bc56ULL, 0x63dca83acd6be04aULL,
+            0x9617b58a79fdd826ULL, 0x563d25e6f891bb33ULL, 0xe3c3d3f3f6d58588ULL, 0x359977baa315b1b4ULL,
+        },
+    },
+    {
+        {
+            0x0df431301d9e6bc5ULL, 0x4074bb10d0003ca5ULL, 0xf440159140f2b453ULL, 0x3a6cc6e14820f5e2ULL,
+            0x4b352bdacf3a37c4ULL, 0x9ef3b8df89ea4c29ULL, 0x8a1b2495a1414892ULL, 0x670b7f423f78b7c9ULL,
+            0x7513c7ccf6ee3c3aULL, 0x9ba96cb53c24408bULL, 0x3316c3dc4ec859f0ULL, 0x501337e1a7f1e218ULL,
+            0x9a1544a6029c1eb5ULL, 0x9b43b15859c3e96fULL, 0x058011e22698bd4bULL, 0x589b8eaea60d54a4ULL,
+            0x68ccb8c6cd7ec24dULL, 0xe55beb5896455705ULL, 0xba6069cf90a8f1e2ULL, 0x896a18c3eb90a6d6ULL,
+            0x870d3d80ae0b9323ULL, 0x48688d8b457f501bULL, 0x8f1a8c1b84b3ba62ULL, 0xd1b7b64dc136f6b3ULL,
+            0x3c6a7025428547e9ULL, 0x199bcc50a190fb6fULL, 0xa5de0eed4bda0979ULL, 0x31041667821cddb5ULL,
+            0xe9df34e2678fb4e3ULL, 0xdd7222eaee54e524ULL, 0xaae6488b26c7af56ULL, 0xe8a560dbbd2eb6b3ULL,
+            0xe37c99a7f5defceaULL, 0x1572be8d78f3afacULL, 0xf69ffb64131633aeULL, 0xa837ae34963616fbULL,
+            0xaf0a9f03d137c170ULL, 0x0d3e02b464018a48ULL, 0x11753aea03bb0ecdULL, 0x32d9cca610dceb34ULL,
+            0x2622bb6a6e7a11e3ULL, 0xdc99a44c515ec8b3ULL, 0xd7d720ad0a770b28ULL, 0xe322f742d6d051c2ULL,
+            0x745f2b6e3ea9cd2bULL, 0x951f21478e6b9662ULL, 0x227f21d8c0713385ULL, 0x0cb729235e6876eeULL,
+            0xd323b857d9721a53ULL, 0xb2f5f599eb743346ULL, 0x0efb30babe65a283ULL, 0x94c1190da321d470ULL,
+            0x117c63209fba9efeULL, 0x738cf92baa4bc2cdULL, 0xc3bdd29b33277165ULL, 0xd78a2fab38f6dc46ULL,
+            0x35c44aafdefb91e2ULL, 0x321e26bf321fb60bULL, 0x12db436288b37172ULL, 0x158a2d49e51c261aULL,
+            0xc9202ac8ba71c873ULL, 0xd02fa93dc97cc7b7ULL, 0x1f8bd11b747e901eULL, 0xf7a17b2f74aa321cULL,
+        },
+        {
+            0x284d02d7552a3e90ULL, 0xeb86a8251533c574ULL, 0xb3fd774eaf4e77f8ULL, 0x31df2951c3ff37b1ULL,
+            0x86e38546195a69e7ULL, 0x6737aaf165a1389aULL, 0x2e2e925079feee0fULL, 0xf7bd5a988596c1bbULL,
+            0xccf835db6a10d2dfULL, 0x6f42700f37c94701ULL, 0xa6e86f7ba2779a5cULL, 0x0a43a4f7036d1ec2ULL,
+            0xd798bd6d52ad26daULL, 0x218f6912af38b818ULL, 0xd48684f266f2e186ULL, 0x8f675048b7b012e5ULL,
+            0xe5e469aac68eaf1dULL, 0xe2740035697de79eULL, 0xc22d6bd6d08baf1dULL, 0x341774636bdc8f41ULL,
+            0x7dfc6b73f7ba322bULL, 0x7566343607bb525bULL, 0xae94d116ccf1e74bULL, 0x6ca1b59934cc2697ULL,
+            0x4c2fb1c45b749cedULL, 0x989999bbdd2ec893ULL, 0xcc4e27afa81bc8a8ULL, 0x6ddadf15ebf85830ULL,
+            0x38fa9cb2ce72bc16ULL, 0xacdaffe39db4bbdaULL, 0xbcc4682ebd095d93ULL, 0x483f539d354559adULL,
+            0x45de92e997e2915cULL, 0x7ec5c881c5344a55ULL, 0x9d1844fffa091545ULL, 0xcd9b08d4dcda27baULL,
+            0x1f7495a5f36c34ceULL, 0x4f0fc9647d99afd7ULL, 0x5ac375ec59321cf2ULL, 0x5c07ce6df7e1d9a2ULL,
+            0x49f211880d688b4cULL, 0xf85fdd8ccad0867aULL, 0x7d510164d8f197a8ULL, 0xc64108c5732cfa0eULL,
+            0xb262d660d3a2c648ULL, 0xd5d5614571dd2efaULL, 0x0ec1a6d0dd5d5391ULL, 0xbf07d939d2535f02ULL,
+            0x035bce3021e51045ULL, 0x423ae115ec99d154ULL, 0x22ea1d3abd893838ULL, 0x517fc1107eaa6a83ULL,
+            0xc5967cdf353aeac6ULL, 0x096ae2c3dff65ce6ULL, 0xab1b908b97dc911bULL, 0xf3d84c286f22611cULL,
+            0x256823815030d8a2ULL, 0x3bd9b119887342e4ULL, 0x59926f3401f437d4ULL, 0x74edf41038d3986fULL,
+            0xe2b35bf615038253ULL, 0x4d09740a6b44db89ULL, 0xa37edaf089c0eeabULL, 0x8263ba2c23e2d62dULL,
+        },
+    },
+    {
+        {
+            0x8784aff57d390c3cULL, 0xfb49ab0635d66c3aULL, 0xdeba73c2562bff1cULL, 0xe2e6bf8cb6e29717ULL,
+            0x0e70431c63d86e46ULL, 0x20d717e16aae6010ULL, 0x031af57cdcf2cd36ULL, 0xd55fbeef1c5357feULL,
+            0xd361d871f4e393feULL, 0xb3416e718d32d214ULL, 0x7b351f93f909fc00ULL, 0x16916de7b96a26bdULL,
+            0x4fec1248b5dedb65ULL, 0xfae1aa9a62bfa096ULL, 0x92e7910a6b0084a9ULL, 0xd12bba8672e8aaa9ULL,
+            0x316558d69efc8f6bULL, 0xb0dde29eb96fee87ULL, 0x2125a2be5bf67eb3ULL, 0x5905903f46531fe4ULL,
+            0x2a9927e8175ff60fULL, 0x794376f2bb5d6d96ULL, 0xfa9f65d2b4848b12ULL, 0x2b92665a263a5091ULL,
+            0xabcaccfab8464c65ULL, 0x05b2fb2a46d1a0bdULL, 0xa879920d28c0d54cULL, 0x50394088a8ea4953ULL,
+            0x61b0c87f0084129dULL, 0x29ebcd1078d6e2b0ULL, 0x2440c652f6bacf89ULL, 0xbd74d596cf4c8eb1ULL,
+            0xe4b009e5c334766bULL, 0x07db26843cf72cb8ULL, 0x4171d5edd5468876ULL, 0x608d5c2c348c143cULL,
+            0xa19e0a2b81da6eb5ULL, 0xb65a7be9354c1390ULL, 0xf4f4c437cb9bb324ULL, 0xfc24806650c823bdULL,
+            0x4c2331521e7f2966ULL, 0x54f66e42eb73bafeULL, 0xf06c11f3d2fe29aeULL, 0x8ba8d0f28cbb0fcbULL,
+            0xf3617850d1ae7976ULL, 0x96463b47cd9a7286ULL, 0x8edc2133b35c3779ULL, 0xae43f70f181d9371ULL,
+            0xe7628d75c9a3c2e7ULL, 0x978499ba4193b333ULL, 0x99bb4bf79b0a46c1ULL, 0x4c52676d7e4d0a58ULL,
+            0x2064ee3910693deeULL, 0xfc43514d16633997ULL, 0x1bc1741ce05c4cceULL, 0x6e9588d40f3396f6ULL,
+            0x146fe816bb3a3708ULL, 0x2b3db8ee05eefa87ULL, 0x6ec21a91189ec0c0ULL, 0xa8a907b34108faf1ULL,
+            0x708b80912235684fULL, 0x2bc8ba70edfe680cULL, 0x4d118826481266efULL, 0x8f93a3a5de887175ULL,
+        },
+        {
+            0x3308e9133a950fe3ULL, 0x939ed8b0d7e91f87ULL, 0x666beee64002b6b0ULL, 0xc8f129ec69ce7811ULL,
+            0xd57593c68ce93ea0ULL, 0x02d6a3e66edcc862ULL, 0xbe1d00d16a2271a6ULL, 0x34fbeaf95e0c673fULL,
+            0x9845ab59483a0e86ULL, 0x257d47d5abf88962ULL, 0x28af39f39319545bULL, 0xe3fce03abd8171eeULL,
+            0xa4c5f606dccc96f1ULL, 0x4d414846267c4962ULL, 0x6ccf77f81d9dbf70ULL, 0x947bf43c729a71ecULL,
+            0xfd656c39c4fa824cULL, 0x8f652cf2d1e04fd6ULL, 0x8cb11929a65b6aeeULL, 0x094948f16a8064daULL,
+            0x7434e703a4d03d5fULL, 0x9361d3f63af4aa35ULL, 0xa998c1eeec3fb422ULL, 0x51eb94754b5992a2ULL,
+            0x6e109c0347ef6979ULL, 0xe3c9738d67c582e2ULL, 0x9c735e3857ec57bfULL, 0xbe6415659e12c64bULL,
+            0x73924584e31b9099ULL, 0x8f676821e60b0945ULL, 0x5614e3a695d5289dULL, 0x7ecd448787517ebaULL,
+            0xc96db02038dbaf5bULL, 0x069299ed774fa6c8ULL, 0x0b4ace5a8ea16ac8ULL, 0xbf2f4f23a6c92295ULL,
+            0x90bdc4f1e931656cULL, 0x7cd5b0b95ac34d3aULL, 0x2032bc59d3dc1710ULL, 0x702c1a0cd5609379ULL,
+            0x609d33abc01ff3feULL, 0x8ae5d8f283b2748bULL, 0x2cf3778fa7eaae1dULL, 0xe8a0d7b1919df9e3ULL,
+            0xe487894f6d602a0bULL, 0x929858549609626aULL, 0x46e540cd86bf46e7ULL, 0xd1daf4382128d9eaULL,
+            0xc47239c06b22ef75ULL, 0x8b7aad8ffea1b991ULL, 0xd6c1d2e315273fa0ULL, 0x2fda11cd74177e6bULL,
+            0x333cb0a145919fd7ULL, 0x5970b31a49f37b16ULL, 0x7890bc68793bb959ULL, 0x2a060f45a1719347ULL,
+            0xeb298f0264bf379dULL, 0xd7c4fd7921707400ULL, 0x374635e7713ed165ULL, 0xc60c008df0296d05ULL,
+            0xbf13739a8d3c7dbbULL, 0xbfb945ef1cf94d1dULL, 0x75fe953c3a3a8315ULL, 0x09f83064f4150c02ULL,
+        },
+    },
+    {
+        {
+            0x6784a3b452055343ULL, 0x73ed26d185738f51ULL, 0x6c59094e8c998390ULL, 0xeade93e19d60d4b5ULL,
+            0x8cf7cc8e62bc869dULL, 0x22f85626f7f69298ULL, 0x6679c449ac22edc0ULL, 0x7017d0003e897435ULL,
+            0x308fc450a6c62bf8ULL, 0x2578b45bc6f34cabULL, 0xcbb936c9d253db39ULL, 0xc4e70e5bbc5e002cULL,
+            0x29db6985be6c9459ULL, 0x96afe876f5f6250cULL, 0x829f766f138f95e6ULL, 0x4369632017c8fa0dULL,
+            0x0da90c817ca890a2ULL, 0x38d160dd675e2376ULL, 0x20df15ad986408eaULL, 0xd192623c3d9b3f41ULL,
+            0xd846f79123baf4aaULL, 0x6cb058a0edfbf056ULL, 0x1b192f0be8dc77a7ULL, 0x3a11b3dfcc81a441ULL,
+            0xe914410093ad7767ULL, 0x3126257e578bdf60ULL, 0xd5d5e470410cb6eaULL, 0x4e1bf5d4209248aeULL,
+            0xe1e4c2924f35192eULL, 0xac9944825cb7ef5eULL, 0x8d2cbe6996eb3475ULL, 0x1bc05d2a079592d7ULL,
+            0x564a9f06755e71f3ULL, 0x9bb767d68e9f2537ULL, 0xe4b045acf13978a2ULL, 0x4b7519cb9028ac83ULL,
+            0x9df655284198b85cULL, 0xdc32ab4d421a2b61ULL, 0x4c5d7f5323c1960cULL, 0xe4273ff318f5c7b3ULL,
+            0xd73ef5ea88a3e99eULL, 0xda2ffb6a863c850bULL, 0x9555a4144e05ad82ULL, 0x950104dc15092ebfULL,
+            0x39d121a61f19dbfeULL, 0xc6804e29d60d7814ULL, 0x7e98bec5ba17d58bULL, 0x8b2c6b0e6c3b749aULL,
+            0x0301a07c84aaccdbULL, 0x93dee719932225a3ULL, 0x381611a50bac0ae1ULL, 0x572a8816f6e407b4ULL,
+            0x0420efe85aa75232ULL, 0xc1f53f78b9ffcf4dULL, 0xbeda53bc95b96ec3ULL, 0x9f357114059c8eabULL,
+            0xe38239260b584150ULL, 0xccbca17f4eed2ad0ULL, 0x1528080b61f54198ULL, 0x5b8cdc4c40d49f30ULL,
+            0x1617db48eb6640d0ULL, 0x6fed27f88a516c99ULL, 0x37056e05b4724179ULL, 0xec7bc122da9538d8ULL,
+        },
+        {
+            0x9fbfe01ca2c0fd57ULL, 0x2fc96b31dccafd9fULL, 0xe26a72009daa1249ULL, 0xe9fb2e3998d16a25ULL,
+            0x4a87dc39d24133aeULL, 0xd5340e98fde806deULL, 0x272b62b5dd0d7fe3ULL, 0xca4625581bf9dbe1ULL,
+            0x8677af77de374a90ULL, 0x27dbec9e28f857edULL, 0xb4aefc44d036612aULL, 0xcf2e8ebdb0f6bb11ULL,
+            0x76023506c94e0532ULL, 0x864e72d4488c7a7aULL, 0x0b81058fdac18fd3ULL, 0xdf93ee5b6674a0f4ULL,
+            0xdb30565511789d77ULL, 0xcf5fe22dc0375f30ULL, 0xa6e62e6e4edb4043ULL, 0xbce383957a728669ULL,
+            0xfe4dd4e9633db2c6ULL, 0x24e68818b2a6d6cdULL, 0x048a89c5424b4cdbULL, 0x7fc7bc75bbbe5768ULL,
+            0x79596343191e0ff2ULL, 0x5510b9cd8306839fULL, 0xff2668b4eae7bb53ULL, 0xb4c03e6363c9e244ULL,
+            0xc9e3c0c1c015eb6fULL, 0x52531f5f898a744fULL, 0x0484005b2a805083ULL, 0x31673b70c6f23c53ULL,
+            0x5bffe158f323a7c2ULL, 0xc742bc0d0c55f125ULL, 0xd95c32fe7e18379dULL, 0xc1f2f613ee3c2e21ULL,
+            0x3217a43ff0daaa0eULL, 0x3a9fa27258257e53ULL, 0x80b42af5a393bcf2ULL, 0xb6967fd6a302f65eULL,
+            0xfdc07bc592dbb125ULL, 0xcb83b8b9f64c3c3bULL, 0x9cb572b041015355ULL, 0xc12dc512aedc530cULL,
+            0xc8db824276c083ceULL, 0x86923b0e2903627fULL, 0x1385cf2be22827cdULL, 0x21b7616ced869ef1ULL,
+            0xc74d497d079901e6ULL, 0x9e03c843bb13f658ULL, 0x915b89077a81ec7fULL, 0x288a10b00768d244ULL,
+            0xd88eb6745a557569ULL, 0xb3c98071a3d13b20ULL, 0x8f23aff44d352f03ULL, 0x2bf39ca10e45bdbbULL,
+            0x0f1bea47e2c68a4cULL, 0xf8d5ab01c1ad6b55ULL, 0x679e0601953d1e31ULL, 0xd793f3aacb3c520fULL,
+            0x96fc350ccdb76eabULL, 0x9fa0178362df447bULL, 0xc11c63febf83598aULL, 0x3aa88df3a1a71323ULL,
+        },
+    },
+    {
+        {
+            0xab2f8338a09ca82aULL, 0x32a2133050a71357ULL, 0xffecf97ca3ff65e1ULL, 0xfb6fd13318f5cb79ULL,
+            0x3acf76875acad366ULL, 0xc577ffff529f74cfULL, 0x368a90182031dd12ULL, 0xafbf2311ad656d52ULL,
+            0x80cd4f9f23fcafddULL, 0x451717a061972d1fULL, 0x0bbcbdae779cfbf3ULL, 0x133ca541293fd40dULL,
+            0x6f241a21fc40b108ULL, 0x9adecbcf0c28110bULL, 0xfab528d93bac6d3aULL, 0xf4ea3d459b0654aaULL,
+            0x7e2e9ef35a5aafbaULL, 0x28730469eded0fc7ULL, 0x3cbae97a12632fbeULL, 0xded6960c0be007a8ULL,
+            0x2a11758a7c52c43eULL, 0x289de4875bda262dULL, 0x6e13eea58caf3fa7ULL, 0x020c8ed0d5d673c1ULL,
+            0xdb4b3e7719d523b6ULL, 0x49143c819d111fc3ULL, 0xe07479f9ddf45d8eULL, 0x68f4654bcc07435bULL,
+            0x513bd537af510064ULL, 0xcf956c3a3933ba38ULL, 0x97e1eaa33f88eeccULL, 0x18be860a2504a1c5ULL,
+            0x84408412fc0bf397ULL, 0x0b6bdba7e154bdf7ULL, 0x1d8f8b446b544be6ULL, 0x6f06b3dcdef17a03ULL,
+            0x30c6e14df59f8cefULL, 0x01c97ba9910219cfULL, 0x33ddcc087d1aeb5cULL, 0xe31b94300cfbcbcfULL,
+            0x0adeb8a98786bb28ULL, 0x3f69d5b0e3ec8f17ULL, 0x99f5a15f635296a6ULL, 0xce9fac7526862e86ULL,
+            0x3a88964201bd7524ULL, 0xec94d643ea71be51ULL, 0xc4257084d97ab1c5ULL, 0xf369b10a73b4d382ULL,
+            0xac02bb473dbc5fd1ULL, 0x4fe73a86d95d7222ULL, 0x858806616fe3d553ULL, 0x10680debcb0693e4ULL,
+            0xcaa9aac77c954093ULL, 0xf29c7530415d71e5ULL, 0xc32b319e09de9e48ULL, 0x1c67107ed497ebc4ULL,
+            0x731da71593324021ULL, 0x49774770588c055aULL, 0xf978dfdc28084220ULL, 0x058b3f2780b5a7ecULL,
+            0xe4ebf2ca21410715ULL, 0xd3841ed97708421fULL, 0x0dbc9401dc51eb4eULL, 0xf47a96de499aa2e1ULL,
+        },
+        {
+            0x224da94d8542ba0cULL, 0xa3426a80b4dd0a4aULL, 0x857caef48ef7e5b6ULL, 0x11356ad6ede44bf5ULL,
+            0x1a32471bd26acd7aULL, 0x199396e31de7b358ULL, 0xb7ca7950dbbb4a92ULL, 0x6ab23720409790a7ULL,
+            0x2abfdb93a3159d10ULL, 0x23913b403946c4a7ULL, 0xac7c9f339a822344ULL, 0x12cffe9625cbe744ULL,
+            0x89558b98548b1946ULL, 0x77be65945c191139ULL, 0x3ba8d1fc701f4347ULL, 0xb143664560327f20ULL,
+            0x48baccc3ef2081ffULL, 0x450c379d24beb8e9ULL, 0x1990b609485db827ULL, 0x6c6a565d7129ccb4ULL,
+            0xf9724a82872bd619ULL, 0xcfe629aa56717e20ULL, 0xfde48d87e844ec93ULL, 0xb32f79e5dc9ce4c1ULL,
+            0x7c9d88364238519fULL, 0xe943aceba65150f9ULL, 0x5301e8550cbdd076ULL, 0xabb8392364453b3cULL,
+            0xdfb4b4a3cf84aa2dULL, 0x269e45f7a6b48a42ULL, 0xd6783043ab383fcfULL, 0xe4ec475d296a69e5ULL,
+            0xe2e273ef65555361ULL, 0x6bd3084210a75af7ULL, 0xf2ebc493b909d8c7ULL, 0x4d20f3d435e9bc94ULL,
+            0xa465e41c3c36d433ULL, 0xc1b259456f4341c0ULL, 0x260093703d6cf2ebULL, 0xda68d9dea0aa9bdaULL,
+            0x5662a12a210b2a47ULL, 0x54675bd1a1b4b467ULL, 0x9dbd416302ec2468ULL, 0x3c7130a5032d823aULL,
+            0xabfdef2d9a4fd92fULL, 0xd4034e276021451fULL, 0x13834d3d0e43ab73ULL, 0xdc181442b438b2d6ULL,
+            0x1736ffb392c25e23ULL, 0x289b94003a946252ULL, 0x99705629b221ca37ULL, 0xa7b22a5bb26775d6ULL,
+            0x2dc12f9f04435661ULL, 0xaadd48b556bc9e7cULL, 0xf6992e8e94b68a49ULL, 0xd50420466c9456e3ULL,
+            0x0ea8305ecdfb1266ULL, 0xfe0b1d7e4f0ef297ULL, 0x563de834c4e56a46ULL, 0xc62b8099b5b264c6ULL,
+            0xf6e76aeaf533c784ULL, 0x0d4680470b790968ULL, 0x288a50754707431eULL, 0x8ad167ed38df547eULL,
+        },
+    },
+};
+
+static const uint64_t side_key = 0x9052fed81a8ca4faULL;
+
+static const uint64_t castle_keys[NUM_CASTLE_PERMS] = {
+    0xd68c2399f968b905ULL, 0xb7bf2902f40fc101ULL, 0x4ec18604cfd551e0ULL, 0xeb8e7fe1b6678e99ULL,
+    0xdcfe68fc0e042fa6ULL,
+};
+
+static const uint64_t en_passant_sq_keys[NUM_SQUARES] = {
+    0x5975ac56f0548ef1ULL, 0x588bf7d0130111aeULL, 0x9ec02036a6688a24ULL, 0x8c9a454af9e09984ULL,
+    0x333ee6727bd12dcbULL, 0x9847468f925dc38cULL, 0x446ed5203696abacULL, 0x71fddf9ef5b5def6ULL,
+    0xd4d61614cc333541ULL, 0xd08a0694cd7f72a7ULL, 0x686cfe3ea1889281ULL, 0xf039404e0dd3333fULL,
+    0x052c620eb18b4246ULL, 0x4e4de47f86d84713ULL, 0xfe0450396b209851ULL, 0x99d6e893b01ed92bULL,
+    0xd94cf8705f8eba86ULL, 0x763451110c00291bULL, 0xdf4f60b9aa45d064ULL, 0xf473d4bfd86ad526ULL,
+    0x41b9e3fa1a6dba94ULL, 0xbaa7cdeb00796a4aULL, 0xf668194c40626450ULL, 0xb894e0ae40a9c87fULL,
+    0x5bc1eea8587d3ddbULL, 0xc4c0ecb91bb50d75ULL, 0x819fdfd17ff2917bULL, 0x681484e54b6b12f7ULL,
+    0x2f510aa2f8977995ULL, 0x7d1582a293b8fa3dULL, 0x3dad5a0f0da45470ULL, 0x33c113aefb480520ULL,
+    0xbd524b2da7ce6c1fULL, 0xe4cc051d00d8ddc0ULL, 0x2995950e206efa90ULL, 0x8b0e5dca588e3f50ULL,
+    0xaabb3583f7f87082ULL, 0x75dbbecfa34cb4d6ULL, 0xf195977068849ae8ULL, 0x9223ca6fbb72767cULL,
+    0xda7211029d59f04eULL, 0x18d9987c6566405cULL, 0x57833aa39ef75a04ULL, 0xd1750e36481f654bULL,
+    0x0ce2b66bc8796acbULL, 0xc7e79aa76c96b057ULL, 0x68f95b6b3c5cdc1dULL, 0x2f5725cf5fc583aeULL,
+    0x6b973013fd4484a6ULL, 0xaaeb2687f2d8bb96ULL, 0xad29cce061ba3934ULL, 0xcb60dd1c437eb1d9ULL,
+    0x5cd6f46b78181bb4ULL, 0x1561cdc95ace24d9ULL, 0xbb774e6705806245ULL, 0xdc29c8df29b2e975ULL,
+    0x6ee5ba502839dccdULL, 0x670869bb64c60f69ULL, 0x008ca2931e927ae7ULL, 0x35cf6c0a27d8de77ULL,
+    0x94a3d86209af3920ULL, 0x4095a276475df5b7ULL, 0x1119e4c257ccf7fbULL, 0x33376166d9064fe8ULL,
+};
+
+// clang-format on
@@ -46,45 +46,51 @@
 // key used to verify struct has been initialised
 const static uint16_t STRUCT_INIT_KEY = 0xdead;
 
-struct game_state {
-    // position hash
-    uint64_t hashkey;
-
-    // the next side to move
-    enum colour side_to_move;
-
-    // keeping track of ply
-    uint16_t ply;         // half-moves
-    uint16_t history_ply; // full move count
-
-    uint8_t fifty_move_counter;
-
-    enum square en_passant_sq;
+// initial number of undo records, the history grows on demand for longer games
+#define INITIAL_HISTORY_CAPACITY (256)
 
-    // active catle permissions
-    struct cast_perm_container castle_perm_container;
-};
+// number of counters in the repetition filter, must be a power of 2
+#define REPETITION_FILTER_SIZE (1024)
+// the fifty move rule is a draw after 100 half-moves without a capture or pawn move
+#define FIFTY_MOVE_RULE_HALF_MOVES (100)
+// a position can't repeat until at least 4 half-moves later
+#define MIN_REPETITION_DISTANCE (4)
 
+// undo record, holds the state that's restored rather than recalculated when the move is reversed
 struct history_item {
-    struct game_state state;
+    uint64_t hashkey;
     struct move mv;
-    enum piece pce_moved;
-    enum piece captured_piece;
+    uint8_t pce_moved;
+    uint8_t captured_piece;
+    uint8_t en_passant_sq;
+    uint16_t fifty_move_counter;
+    uint16_t plies_since_null;
+    struct cast_perm_container castle_perm_container;
+    uint64_t checkers;
+    uint64_t pinned[NUM_COLOURS];
 };
 
 struct position_history {
-    struct history_item items[MAX_GAME_MOVES];
-    uint16_t num_used_slots;
+    struct history_item *items;
+    uint32_t capacity;
+    uint32_t num_used_slots;
+    // count of the stored hashes that map to each counter, a zero count means the position can't
+    // be a repetition so there's no need to scan the history
+    uint16_t repetition_filter[REPETITION_FILTER_SIZE];
 };
 
 // represents the current game position
 struct position {
-    struct game_state state;
-    // current board representation
-    struct board *brd;
+    // the board and game state being worked on, either 'own_snapshot' or one attached by the caller
+    struct pos_snapshot *snap;
     // position history
     struct position_history history;
+    // attack map for the position with hash 'attack_map_hash', built on demand
+    struct attack_map attack_map;
+    uint64_t attack_map_hash;
+    bool attack_map_valid;
     uint16_t struct_init_key;
+    struct pos_snapshot own_snapshot;
 };
 
 static void init_pos_struct(struct position *const pos);
@@ -95,9 +101,15 @@ static void do_capture_move(struct position *const pos, enum square from_sq, enu
 static void make_king_side_castle_move(struct position *const pos);
 static void make_queen_side_castle_move(struct position *const pos);
 static void make_en_passant_move(struct position *const pos, enum square from_sq, enum square to_sq);
-static enum move_legality get_move_legal_status(const struct position *const pos, struct move mov);
+static void make_move(struct position *const pos, struct move mv);
+static void apply_move(struct position *const pos, struct move mv, enum piece pce_to_move);
+static enum move_legality get_move_legal_status(const struct position *const pos, struct move mv);
+static void update_check_info(struct position *const pos);
+static uint64_t get_pinned_pieces(const struct board *const brd, enum colour colour);
 static bool is_castle_move_legal(const struct position *const pos, struct move mov, enum colour side_to_move,
                                  enum colour attacking_side);
+static bool is_pawn_move_pseudo_legal(const struct position *const pos, struct move mv, enum colour side_to_move);
+static bool is_castle_move_pseudo_legal(const struct position *const pos, struct move mv, enum colour side_to_move);
 static void update_castle_perms(struct position *const pos, struct move mv, enum piece pce_being_moved);
 static void pos_move_piece(struct position *const pos, enum piece pce, enum square from_sq, enum square to_sq);
 static void pos_remove_piece(struct position *const pos, enum piece pce, enum square sq);
@@ -120,9 +132,11 @@ static void reverse_castle_move(struct position *const pos, struct move mv, enum
 static void position_hist_push(struct position *const pos, struct move mv, enum piece pce_moved,
                                enum piece captured_piece);
 static struct history_item position_hist_pop(struct position *const pos);
+static void position_hist_grow(struct position *const pos);
 static bool validate_position_history(const struct position *const pos);
 static bool position_hist_compare(const struct position *const pos1, const struct position *const pos2);
-static bool compare_game_states(const struct game_state *gs1, const struct game_state *gs2);
+static uint32_t get_repetition_filter_index(uint64_t hashkey);
+static uint32_t get_max_repetition_distance(const struct game_state *const state, uint32_t num_prev_positions);
 
 // set up bitboards for all squares that need to be checked when
 // testing castle move validity
@@ -140,11 +154,7 @@ struct position *pos_create(void) {
     struct position *retval = (struct position *)malloc(sizeof(struct position));
     init_pos_struct(retval);
 
-    struct board *brd = brd_allocate();
-    retval->brd = brd;
-
-    init_key_mgmt();
-    occ_mask_init();
+    occ_mask_init_slider_attacks();
 
     return retval;
 }
@@ -171,7 +181,7 @@ void pos_destroy(struct position *const pos) {
         print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Position structure not initialised");
     }
 
-    brd_deallocate(pos->brd);
+    free(pos->history.items);
 
     memset(pos, 0, sizeof(struct position));
     free(pos);
@@ -185,11 +195,11 @@ void pos_destroy(struct position *const pos) {
  */
 struct board *pos_get_board(const struct position *const pos) {
     assert(validate_position(pos));
-    return pos->brd;
+    return &pos->snap->brd;
 }
 
 uint16_t pos_get_ply(const struct position *const pos) {
-    return pos->state.ply;
+    return pos->snap->state.ply;
 }
 
 /**
@@ -200,7 +210,7 @@ uint16_t pos_get_ply(const struct position *const pos) {
  */
 enum colour pos_get_side_to_move(const struct position *const pos) {
     assert(validate_position(pos));
-    return pos->state.side_to_move;
+    return pos->snap->state.side_to_move;
 }
 
 /**
@@ -210,7 +220,7 @@ enum colour pos_get_side_to_move(const struct position *const pos) {
  * @return      The castle permissions available
  */
 struct cast_perm_container pos_get_cast_perm(const struct position *const pos) {
-    return pos->state.castle_perm_container;
+    return pos->snap->state.castle_perm_container;
 }
 
 /**
@@ -221,7 +231,7 @@ struct cast_perm_container pos_get_cast_perm(const struct position *const pos) {
  */
 enum square pos_get_en_pass_sq(const struct position *const pos) {
     if (pos_is_en_passant_active(pos)) {
-        return pos->state.en_passant_sq;
+        return pos->snap->state.en_passant_sq;
     }
     return NO_SQUARE;
 }
@@ -234,7 +244,7 @@ enum square pos_get_en_pass_sq(const struct position *const pos) {
  * @return     true is enpassant is active, false otherwise
  */
 bool pos_is_en_passant_active(const struct position *const pos) {
-    return pos->state.en_passant_sq != NO_SQUARE;
+    return pos->snap->state.en_passant_sq != NO_SQUARE;
 }
 
 /**
@@ -244,7 +254,7 @@ bool pos_is_en_passant_active(const struct position *const pos) {
  * @param perms         Castle permissions to set
  */
 void pos_set_cast_perm(struct position *const pos, struct cast_perm_container perms) {
-    pos->state.castle_perm_container = perms;
+    pos->snap->state.castle_perm_container = perms;
 }
 
 /**
@@ -258,30 +268,386 @@ void pos_set_cast_perm(struct position *const pos, struct cast_perm_container pe
 bool validate_position(const struct position *const pos) {
     assert(pos->struct_init_key == STRUCT_INIT_KEY);
 
-    assert(validate_board(pos->brd));
-    assert(validate_colour(pos->state.side_to_move));
+    assert(validate_board(&pos->snap->brd));
+    assert(validate_colour(pos->snap->state.side_to_move));
 
     return true;
 }
 #pragma GCC diagnostic pop
 
+/**
+ * @brief       Makes the given move, and tests the resulting position for legality
+ * @details     If the move is illegal, it should be reversed using pos_take_move()
+ *
+ * @param pos   The position
+ * @param mv    The (pseudo-legal) move to make
+ * @return LEGAL_MOVE if the move doesn't leave the King in check, ILLEGAL_MOVE otherwise
+ */
 enum move_legality pos_make_move(struct position *const pos, struct move mv) {
     assert(validate_position(pos));
     assert(validate_move(mv));
 
+    const enum move_legality legality = get_move_legal_status(pos, mv);
+
+    make_move(pos, mv);
+
+    return legality;
+}
+
+/**
+ * @brief       Makes a move that is known to be legal, skipping the legality test
+ * @details     Intended for moves from mv_gen_legal_moves(). Use pos_take_move() to reverse the move.
+ *
+ * @param pos   The position
+ * @param mv    The legal move to make
+ */
+void pos_make_legal_move(struct position *const pos, struct move mv) {
+    assert(validate_position(pos));
+    assert(validate_move(mv));
+    assert(get_move_legal_status(pos, mv) == LEGAL_MOVE);
+
+    make_move(pos, mv);
+}
+
+/**
+ * @brief       Copies the position's board and game state into a snapshot
+ * @details     The move history isn't part of the snapshot.
+ *
+ * @param pos   The position
+ * @param snap  The snapshot to fill
+ */
+void pos_save_snapshot(const struct position *const pos, struct pos_snapshot *const snap) {
+    assert(validate_position(pos));
+
+    memcpy(snap, pos->snap, sizeof(struct pos_snapshot));
+}
+
+/**
+ * @brief       Makes the position work directly on the caller's snapshot, without copying it
+ * @details     Used with copy-make, so the move generator and the other pos_ functions can run on each
+ *              snapshot in turn. The position's move history is discarded, since it doesn't belong to the
+ *              snapshot. The snapshot must stay in scope for as long as the position uses it.
+ *
+ * @param pos   The position
+ * @param snap  The snapshot to attach
+ */
+void pos_attach_snapshot(struct position *const pos, struct pos_snapshot *const snap) {
+    assert(pos->struct_init_key == STRUCT_INIT_KEY);
+    assert(validate_board(&snap->brd));
+
+    pos->snap = snap;
+    if (pos->history.num_used_slots != 0) {
+        // drop the history along with its repetition counts
+        memset(pos->history.repetition_filter, 0, sizeof(pos->history.repetition_filter));
+        pos->history.num_used_slots = 0;
+    }
+    pos->attack_map_valid = false;
+}
+
+/**
+ * @brief       Copy-make: makes the move on a copy of the source snapshot, leaving the source untouched
+ * @details     The board and game state of src are copied into dst and the move is applied there. Snapshots
+ *              have no move history, so there's nothing to reverse; the caller keeps a stack of snapshots
+ *              instead, and can keep a matching stack of hashes for pos_is_snapshot_repetition().
+ *
+ * @param src   The snapshot to make the move from
+ * @param dst   The snapshot to hold the result, mustn't overlap src
+ * @param mv    The (pseudo-legal) move to make
+ * @return LEGAL_MOVE if the move doesn't leave the King in check, ILLEGAL_MOVE otherwise
+ */
+enum move_legality pos_make_move_copy(const struct pos_snapshot *const src, struct pos_snapshot *const dst,
+                                      struct move mv) {
+    assert(validate_board(&src->brd));
+    assert(src != dst);
+    assert(validate_move(mv));
+
+    memcpy(dst, src, sizeof(struct pos_snapshot));
+
+    // the move code only touches the snapshot, so a minimal position wrapping dst is enough
+    struct position view;
+    view.snap = dst;
+    view.struct_init_key = STRUCT_INIT_KEY;
+
+    const enum move_legality legality = get_move_legal_status(&view, mv);
+
+    enum piece pce_to_move;
+    brd_try_get_piece_on_square(&dst->brd, move_decode_from_sq(mv), &pce_to_move);
+
+    apply_move(&view, mv, pce_to_move);
+
+    return legality;
+}
+
+/**
+ * @brief       Tests if a snapshot repeats an earlier position, using a caller-owned stack of hashes
+ * @details     The copy-make equivalent of pos_is_repetition(). hashes[num_hashes - 1] is the hash from one
+ *              half-move before the snapshot, hashes[num_hashes - 2] from two half-moves before, and so on.
+ *              As with pos_is_repetition(), the scan stops at the last capture, pawn move or null move.
+ *
+ * @param snap          The snapshot to test
+ * @param hashes        The hashes of the preceding positions, oldest first
+ * @param num_hashes    The number of hashes
+ * @return true if the snapshot is a repetition, false otherwise
+ */
+bool pos_is_snapshot_repetition(const struct pos_snapshot *const snap, const uint64_t *const hashes,
+                                uint32_t num_hashes) {
+    const uint64_t hashkey = snap->state.hashkey;
+    const uint32_t max_distance = get_max_repetition_distance(&snap->state, num_hashes);
+
+    for (uint32_t distance = MIN_REPETITION_DISTANCE; distance <= max_distance; distance += 2) {
+        if (hashes[num_hashes - distance] == hashkey) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief       Makes a null move, passing the turn to the other side
+ * @details     Flips the side to move and clears any en passant square. The board isn't changed, and the fifty
+ *              move counter is incremented as for a reversible move. The side to move mustn't be in check.
+ *              Use pos_take_null_move() to reverse it.
+ *
+ * @param pos   The position
+ */
+void pos_make_null_move(struct position *const pos) {
+    assert(validate_position(pos));
+    assert(!pos_is_in_check(pos));
+
+    position_hist_push(pos, move_get_no_move(), NO_PIECE, NO_PIECE);
+
+    pos->snap->state.ply++;
+    pos->snap->state.history_ply++;
+    pos->snap->state.en_passant_sq = NO_SQUARE;
+    // the null move doesn't change the board, so it counts towards the fifty move rule like any reversible
+    // move, but repetition checks mustn't look back past it
+    pos->snap->state.fifty_move_counter++;
+    pos->snap->state.plies_since_null = 0;
+
+    swap_side(pos);
+
+    // the side that passed wasn't in check, and the pins are unchanged
+    pos->snap->state.checkers = 0;
+}
+
+/**
+ * @brief       Reverses a null move made with pos_make_null_move()
+ *
+ * @param pos   The position
+ */
+void pos_take_null_move(struct position *const pos) {
+    assert(validate_position(pos));
+
+    assert(pos->history.num_used_slots > 0);
+    assert(pos->history.items[pos->history.num_used_slots - 1].pce_moved == NO_PIECE);
+
+    position_hist_pop(pos);
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+
+/**
+ * @brief       Tests if a move (eg, from the TT or a killer) could have been generated in the given position
+ * @details     Uses the board bitboards and occupancy masks, so there's no need to generate all moves. The
+ *              move may still leave the King in check, see pos_is_legal().
+ *
+ * @param pos   The position
+ * @param mv    The move to test
+ * @return true if the move is pseudo-legal, false otherwise
+ */
+bool pos_is_pseudo_legal(const struct position *const pos, struct move mv) {
+    assert(validate_position(pos));
+
+    const struct board *const brd = pos_get_board(pos);
+    const enum colour side_to_move = pos_get_side_to_move(pos);
+
+    const enum square from_sq = move_decode_from_sq(mv);
+    const enum square to_sq = move_decode_to_sq(mv);
+
+    enum piece pce;
+    if (!brd_try_get_piece_on_square(brd, from_sq, &pce) || pce_get_colour(pce) != side_to_move) {
+        return false;
+    }
+
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t opposite_colour_bb = brd_get_colour_bb(brd, pce_swap_side(side_to_move));
+    const enum piece_role role = pce_get_role(pce);
+
+    if (role == PAWN) {
+        return is_pawn_move_pseudo_legal(pos, mv, side_to_move);
+    }
+
+    if (move_is_castle(mv)) {
+        return role == KING && is_castle_move_pseudo_legal(pos, mv, side_to_move);
+    }
+
+    // only Pawns can promote, double move or capture en passant
+    const enum move_type mv_type = move_get_move_type(mv);
+    if (mv_type != MV_TYPE_QUIET && mv_type != MV_TYPE_CAPTURE) {
+        return false;
+    }
+
+    const uint64_t target_bb = mv_type == MV_TYPE_CAPTURE ? opposite_colour_bb : ~occupied_sq_bb;
+    if (bb_is_clear(target_bb, to_sq)) {
+        return false;
+    }
+
+    switch (role) {
+    case KNIGHT:
+        return bb_is_set(occ_mask_get_knight(from_sq), to_sq);
+    case BISHOP:
+        return bb_is_set(occ_mask_get_bishop_attacks(from_sq, occupied_sq_bb), to_sq);
+    case ROOK:
+        return bb_is_set(occ_mask_get_rook_attacks(from_sq, occupied_sq_bb), to_sq);
+    case QUEEN:
+        return bb_is_set(occ_mask_get_queen_attacks(from_sq, occupied_sq_bb), to_sq);
+    case KING:
+        return bb_is_set(occ_mask_get_king(from_sq), to_sq);
+    default:
+        return false;
+    }
+}
+
+#pragma GCC diagnostic pop
+
+/**
+ * @brief       Tests if a pseudo-legal move is legal, without making the move
+ * @details     Calculates the occupancy after the move, and tests if the King is then attacked. Any piece
+ *              captured by the move can't take part in the attack.
+ *
+ * @param pos   The position
+ * @param mv    The pseudo-legal move to test
+ * @return true if the move doesn't leave the King in check, false otherwise
+ */
+bool pos_is_legal(const struct position *const pos, struct move mv) {
+    assert(validate_position(pos));
+    assert(pos_is_pseudo_legal(pos, mv));
+
+    return get_move_legal_status(pos, mv) == LEGAL_MOVE;
+}
+
+/**
+ * @brief       Returns the pieces giving check to the side to move
+ *
+ * @param pos   The position
+ * @return      Bitboard of the checking pieces, 0 if the side to move isn't in check
+ */
+uint64_t pos_get_checkers(const struct position *const pos) {
+    return pos->snap->state.checkers;
+}
+
+/**
+ * @brief       Returns the pieces of the given colour that are pinned against their own King
+ *
+ * @param pos       The position
+ * @param colour    The colour of the pinned pieces
+ * @return          Bitboard of the pinned pieces
+ */
+uint64_t pos_get_pinned(const struct position *const pos, enum colour colour) {
+    assert(validate_colour(colour));
+    return pos->snap->state.pinned[colour];
+}
+
+/**
+ * @brief       Tests if the side to move is in check
+ *
+ * @param pos   The position
+ * @return      true if in check, false otherwise
+ */
+bool pos_is_in_check(const struct position *const pos) {
+    return pos->snap->state.checkers != 0;
+}
+
+/**
+ * @brief       Returns the squares attacked by each side, building them if needed
+ * @details     The attack map is cached against the position hash, so repeated calls for the same node (eg,
+ *              from different evaluation terms) share one calculation.
+ *
+ * @param pos   The position
+ * @return      The attack map for the current position
+ */
+const struct attack_map *pos_get_attack_map(struct position *const pos) {
+    assert(validate_position(pos));
+
+    if (!pos->attack_map_valid || pos->attack_map_hash != pos->snap->state.hashkey) {
+        att_chk_build_attack_map(pos, &pos->attack_map);
+        pos->attack_map_hash = pos->snap->state.hashkey;
+        pos->attack_map_valid = true;
+    }
+    return &pos->attack_map;
+}
+
+/**
+ * @brief       Tests if the current position has occurred before
+ * @details     Only the positions since the last capture, pawn move or null move are checked, and only those
+ *              with the same side to move. The scan is bounded by the smaller of the fifty move counter and
+ *              the number of half-moves since the last null move. A per-game filter of the stored hashes avoids the scan when the
+ *              position can't be a repetition.
+ *
+ * @param pos   The position
+ * @return      true if the position is a repetition, false otherwise
+ */
+bool pos_is_repetition(const struct position *const pos) {
+    const uint64_t hashkey = pos->snap->state.hashkey;
+
+    if (pos->history.repetition_filter[get_repetition_filter_index(hashkey)] == 0) {
+        return false;
+    }
+
+    const uint32_t num_used_slots = pos->history.num_used_slots;
+    const uint32_t max_distance = get_max_repetition_distance(&pos->snap->state, num_used_slots);
+
+    // the undo record 'distance' slots back holds the hash from 'distance' half-moves ago
+    for (uint32_t distance = MIN_REPETITION_DISTANCE; distance <= max_distance; distance += 2) {
+        if (pos->history.items[num_used_slots - distance].hashkey == hashkey) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief       Tests if the game is drawn under the fifty move rule
+ *
+ * @param pos   The position
+ * @return      true if there have been at least 100 half-moves without a capture or pawn move
+ */
+bool pos_is_fifty_move_draw(const struct position *const pos) {
+    return pos->snap->state.fifty_move_counter >= FIFTY_MOVE_RULE_HALF_MOVES;
+}
+
+/**
+ * @brief       Returns the number of half-moves since the last capture or pawn move
+ *
+ * @param pos   The position
+ * @return      The fifty move counter
+ */
+uint16_t pos_get_fifty_move_counter(const struct position *const pos) {
+    return pos->snap->state.fifty_move_counter;
+}
+
+static void make_move(struct position *const pos, struct move mv) {
     const enum square from_sq = move_decode_from_sq(mv);
     const enum square to_sq = move_decode_to_sq(mv);
 
     enum piece pce_to_move;
-    brd_try_get_piece_on_square(pos->brd, from_sq, &pce_to_move);
+    brd_try_get_piece_on_square(&pos->snap->brd, from_sq, &pce_to_move);
 
     enum piece pce_capt;
-    brd_try_get_piece_on_square(pos->brd, to_sq, &pce_capt);
+    brd_try_get_piece_on_square(&pos->snap->brd, to_sq, &pce_capt);
     // save state
     position_hist_push(pos, mv, pce_to_move, pce_capt);
 
-    pos->state.ply++;
-    pos->state.history_ply++;
+    apply_move(pos, mv, pce_to_move);
+}
+
+static void apply_move(struct position *const pos, struct move mv, enum piece pce_to_move) {
+    const enum square from_sq = move_decode_from_sq(mv);
+    const enum square to_sq = move_decode_to_sq(mv);
+
+    pos->snap->state.ply++;
+    pos->snap->state.history_ply++;
 
     assert(validate_piece(pce_to_move));
 
@@ -294,11 +660,11 @@ enum move_legality pos_make_move(struct position *const pos, struct move mv) {
         do_capture_move(pos, from_sq, to_sq, pce_to_move);
         break;
     case MV_TYPE_DOUBLE_PAWN:
-        pos->state.en_passant_sq = get_en_pass_sq(pos->state.side_to_move, from_sq);
+        pos->snap->state.en_passant_sq = get_en_pass_sq(pos->snap->state.side_to_move, from_sq);
         pos_move_piece(pos, pce_to_move, from_sq, to_sq);
         break;
     case MV_TYPE_EN_PASS:
-        pos->state.en_passant_sq = NO_SQUARE;
+        pos->snap->state.en_passant_sq = NO_SQUARE;
         make_en_passant_move(pos, from_sq, to_sq);
         break;
     case MV_TYPE_QUEEN_CASTLE:
@@ -308,35 +674,35 @@ enum move_legality pos_make_move(struct position *const pos, struct move mv) {
         make_king_side_castle_move(pos);
         break;
     case MV_TYPE_PROMOTE_BISHOP: {
-        const enum piece bishop = pos->state.side_to_move == WHITE ? WHITE_BISHOP : BLACK_BISHOP;
+        const enum piece bishop = pos->snap->state.side_to_move == WHITE ? WHITE_BISHOP : BLACK_BISHOP;
         do_promotion_quiet(pos, pce_to_move, from_sq, to_sq, bishop);
     } break;
     case MV_TYPE_PROMOTE_KNIGHT: {
-        const enum piece knight = pos->state.side_to_move == WHITE ? WHITE_KNIGHT : BLACK_KNIGHT;
+        const enum piece knight = pos->snap->state.side_to_move == WHITE ? WHITE_KNIGHT : BLACK_KNIGHT;
         do_promotion_quiet(pos, pce_to_move, from_sq, to_sq, knight);
     } break;
     case MV_TYPE_PROMOTE_QUEEN: {
-        const enum piece queen = pos->state.side_to_move == WHITE ? WHITE_QUEEN : BLACK_QUEEN;
+        const enum piece queen = pos->snap->state.side_to_move == WHITE ? WHITE_QUEEN : BLACK_QUEEN;
         do_promotion_quiet(pos, pce_to_move, from_sq, to_sq, queen);
     } break;
     case MV_TYPE_PROMOTE_ROOK: {
-        const enum piece rook = pos->state.side_to_move == WHITE ? WHITE_ROOK : BLACK_ROOK;
+        const enum piece rook = pos->snap->state.side_to_move == WHITE ? WHITE_ROOK : BLACK_ROOK;
         do_promotion_quiet(pos, pce_to_move, from_sq, to_sq, rook);
     } break;
     case MV_TYPE_PROMOTE_BISHOP_CAPTURE: {
-        const enum piece bishop = pos->state.side_to_move == WHITE ? WHITE_BISHOP : BLACK_BISHOP;
+        const enum piece bishop = pos->snap->state.side_to_move == WHITE ? WHITE_BISHOP : BLACK_BISHOP;
         do_promotion_capture(pos, pce_to_move, from_sq, to_sq, bishop);
     } break;
     case MV_TYPE_PROMOTE_KNIGHT_CAPTURE: {
-        const enum piece knight = pos->state.side_to_move == WHITE ? WHITE_KNIGHT : BLACK_KNIGHT;
+        const enum piece knight = pos->snap->state.side_to_move == WHITE ? WHITE_KNIGHT : BLACK_KNIGHT;
         do_promotion_capture(pos, pce_to_move, from_sq, to_sq, knight);
     } break;
     case MV_TYPE_PROMOTE_QUEEN_CAPTURE: {
-        const enum piece queen = pos->state.side_to_move == WHITE ? WHITE_QUEEN : BLACK_QUEEN;
+        const enum piece queen = pos->snap->state.side_to_move == WHITE ? WHITE_QUEEN : BLACK_QUEEN;
         do_promotion_capture(pos, pce_to_move, from_sq, to_sq, queen);
     } break;
     case MV_TYPE_PROMOTE_ROOK_CAPTURE: {
-        const enum piece rook = pos->state.side_to_move == WHITE ? WHITE_ROOK : BLACK_ROOK;
+        const enum piece rook = pos->snap->state.side_to_move == WHITE ? WHITE_ROOK : BLACK_ROOK;
         do_promotion_capture(pos, pce_to_move, from_sq, to_sq, rook);
     } break;
     default:
@@ -346,15 +712,20 @@ enum move_legality pos_make_move(struct position *const pos, struct move mv) {
 
     // some cleanup
     // ============
-    const enum move_legality legality = get_move_legal_status(pos, mv);
     if (!move_is_double_pawn(mv)) {
-        pos->state.en_passant_sq = NO_SQUARE;
+        pos->snap->state.en_passant_sq = NO_SQUARE;
     }
+    if (move_is_capture(mv) || pce_get_role(pce_to_move) == PAWN) {
+        pos->snap->state.fifty_move_counter = 0;
+    } else {
+        pos->snap->state.fifty_move_counter++;
+    }
+    pos->snap->state.plies_since_null++;
     update_castle_perms(pos, mv, pce_to_move);
 
     swap_side(pos);
 
-    return legality;
+    update_check_info(pos);
 }
 
 struct move pos_take_move(struct position *const pos) {
@@ -362,40 +733,42 @@ struct move pos_take_move(struct position *const pos) {
 
     // restore state
     const struct history_item hist = position_hist_pop(pos);
+    const enum piece pce_moved = (enum piece)hist.pce_moved;
+    const enum piece captured_piece = (enum piece)hist.captured_piece;
 
     // now update the board
     // ====================
     const enum move_type mv_type = move_get_move_type(hist.mv);
     switch (mv_type) {
     case MV_TYPE_QUIET:
-        reverse_quiet_move(pos, hist.mv, hist.pce_moved);
+        reverse_quiet_move(pos, hist.mv, pce_moved);
         break;
     case MV_TYPE_CAPTURE:
-        reverse_capture_move(pos, hist.mv, hist.pce_moved, hist.captured_piece);
+        reverse_capture_move(pos, hist.mv, pce_moved, captured_piece);
         break;
     case MV_TYPE_DOUBLE_PAWN:
-        reverse_quiet_move(pos, hist.mv, hist.pce_moved);
+        reverse_quiet_move(pos, hist.mv, pce_moved);
         break;
     case MV_TYPE_EN_PASS:
-        reverse_en_passant_move(pos, hist.mv, pos->state.side_to_move);
+        reverse_en_passant_move(pos, hist.mv, pos->snap->state.side_to_move);
         break;
     case MV_TYPE_QUEEN_CASTLE:
-        reverse_castle_move(pos, hist.mv, pos->state.side_to_move);
+        reverse_castle_move(pos, hist.mv, pos->snap->state.side_to_move);
         break;
     case MV_TYPE_KING_CASTLE:
-        reverse_castle_move(pos, hist.mv, pos->state.side_to_move);
+        reverse_castle_move(pos, hist.mv, pos->snap->state.side_to_move);
         break;
     case MV_TYPE_PROMOTE_BISHOP:
     case MV_TYPE_PROMOTE_KNIGHT:
     case MV_TYPE_PROMOTE_QUEEN:
     case MV_TYPE_PROMOTE_ROOK:
-        reverse_quiet_promotion_move(pos, hist.mv, hist.pce_moved);
+        reverse_quiet_promotion_move(pos, hist.mv, pce_moved);
         break;
     case MV_TYPE_PROMOTE_BISHOP_CAPTURE:
     case MV_TYPE_PROMOTE_KNIGHT_CAPTURE:
     case MV_TYPE_PROMOTE_QUEEN_CAPTURE:
     case MV_TYPE_PROMOTE_ROOK_CAPTURE:
-        reverse_capture_promotion_move(pos, hist.mv, hist.pce_moved, hist.captured_piece);
+        reverse_capture_promotion_move(pos, hist.mv, pce_moved, captured_piece);
         break;
     default:
         print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid move type");
@@ -408,7 +781,7 @@ struct move pos_take_move(struct position *const pos) {
 static void reverse_quiet_move(struct position *const pos, struct move mv, enum piece pce_moved) {
     const enum square from_sq = move_decode_from_sq(mv);
     const enum square to_sq = move_decode_to_sq(mv);
-    brd_move_piece(pos->brd, pce_moved, to_sq, from_sq);
+    brd_move_piece(&pos->snap->brd, pce_moved, to_sq, from_sq);
 }
 
 static void reverse_capture_move(struct position *const pos, struct move mv, enum piece pce_moved,
@@ -416,9 +789,9 @@ static void reverse_capture_move(struct position *const pos, struct move mv, enu
 
     const enum square from_sq = move_decode_from_sq(mv);
     const enum square to_sq = move_decode_to_sq(mv);
-    brd_move_piece(pos->brd, pce_moved, to_sq, from_sq);
+    brd_move_piece(&pos->snap->brd, pce_moved, to_sq, from_sq);
 
-    brd_add_piece(pos->brd, captured_piece, to_sq);
+    brd_add_piece(&pos->snap->brd, captured_piece, to_sq);
 }
 
 static void reverse_quiet_promotion_move(struct position *const pos, struct move mv, enum piece pce_moved) {
@@ -427,9 +800,9 @@ static void reverse_quiet_promotion_move(struct position *const pos, struct move
     const enum square to_sq = move_decode_to_sq(mv);
 
     // remove promoted piece
-    brd_remove_from_square(pos->brd, to_sq);
+    brd_remove_from_square(&pos->snap->brd, to_sq);
     // put piece back to its original square
-    brd_add_piece(pos->brd, pce_moved, from_sq);
+    brd_add_piece(&pos->snap->brd, pce_moved, from_sq);
 }
 
 static void reverse_capture_promotion_move(struct position *const pos, struct move mv, enum piece pce_moved,
@@ -440,11 +813,11 @@ static void reverse_capture_promotion_move(struct position *const pos, struct mo
     const enum square to_sq = move_decode_to_sq(mv);
 
     // remove promoted piece and add the captured piece
-    brd_remove_from_square(pos->brd, to_sq);
-    brd_add_piece(pos->brd, captured_piece, to_sq);
+    brd_remove_from_square(&pos->snap->brd, to_sq);
+    brd_add_piece(&pos->snap->brd, captured_piece, to_sq);
 
     // put piece back to its original square
-    brd_add_piece(pos->brd, pce_moved, from_sq);
+    brd_add_piece(&pos->snap->brd, pce_moved, from_sq);
 }
 
 static void reverse_en_passant_move(struct position *const pos, struct move mv, enum colour side) {
@@ -454,15 +827,15 @@ static void reverse_en_passant_move(struct position *const pos, struct move mv,
     switch (side) {
     case WHITE:
         // note: to/from swapped
-        brd_move_piece(pos->brd, WHITE_PAWN, to_sq, from_sq);
+        brd_move_piece(&pos->snap->brd, WHITE_PAWN, to_sq, from_sq);
         const enum square wcapture_sq = sq_get_square_minus_1_rank(to_sq);
-        brd_add_piece(pos->brd, BLACK_PAWN, wcapture_sq);
+        brd_add_piece(&pos->snap->brd, BLACK_PAWN, wcapture_sq);
         break;
     case BLACK:
         // note: to/from swapped
-        brd_move_piece(pos->brd, BLACK_PAWN, to_sq, from_sq);
+        brd_move_piece(&pos->snap->brd, BLACK_PAWN, to_sq, from_sq);
         const enum square bcapture_sq = sq_get_square_plus_1_rank(to_sq);
-        brd_add_piece(pos->brd, WHITE_PAWN, bcapture_sq);
+        brd_add_piece(&pos->snap->brd, WHITE_PAWN, bcapture_sq);
         break;
     default:
         print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid side : reverse en passant");
@@ -480,7 +853,7 @@ static void do_promotion_capture(struct position *const pos, enum piece pce_to_m
                                  enum square to_sq, enum piece target_promotion_pce) {
 
     enum piece pce_being_captured;
-    brd_try_get_piece_on_square(pos->brd, to_sq, &pce_being_captured);
+    brd_try_get_piece_on_square(&pos->snap->brd, to_sq, &pce_being_captured);
 
     pos_remove_piece(pos, pce_being_captured, to_sq);
 
@@ -489,8 +862,8 @@ static void do_promotion_capture(struct position *const pos, enum piece pce_to_m
 }
 
 static void swap_side(struct position *const pos) {
-    pos->state.side_to_move = pce_swap_side(pos->state.side_to_move);
-    pos->state.hashkey = hash_side_update(pos->state.hashkey);
+    pos->snap->state.side_to_move = pce_swap_side(pos->snap->state.side_to_move);
+    pos->snap->state.hashkey = hash_side_update(pos->snap->state.hashkey);
 }
 
 /**
@@ -503,36 +876,40 @@ bool pos_compare(const struct position *first, const struct position *second) {
     assert(validate_position(first));
     assert(validate_position(second));
 
-    if (brd_compare(first->brd, second->brd) == false) {
+    if (brd_compare(&first->snap->brd, &second->snap->brd) == false) {
         printf("pos_compare: Board compare failed\n");
         return false;
     }
 
-    if (first->state.side_to_move != second->state.side_to_move) {
+    if (first->snap->state.side_to_move != second->snap->state.side_to_move) {
         printf("pos_compare: side to move is different\n");
         return false;
     }
 
-    if (first->state.ply != second->state.ply) {
+    if (first->snap->state.ply != second->snap->state.ply) {
         printf("pos_compare: ply is different\n");
         return false;
     }
 
-    if (first->state.history_ply != second->state.history_ply) {
+    if (first->snap->state.history_ply != second->snap->state.history_ply) {
         printf("pos_compare: history_ply is different\n");
         return false;
     }
 
-    if (first->state.fifty_move_counter != second->state.fifty_move_counter) {
+    if (first->snap->state.fifty_move_counter != second->snap->state.fifty_move_counter) {
         printf("pos_compare: 50 move counter is different\n");
         return false;
     }
-    if (cast_compare_perms(first->state.castle_perm_container, second->state.castle_perm_container) == false) {
+    if (first->snap->state.plies_since_null != second->snap->state.plies_since_null) {
+        printf("pos_compare: plies since null move is different\n");
+        return false;
+    }
+    if (cast_compare_perms(first->snap->state.castle_perm_container, second->snap->state.castle_perm_container) == false) {
         printf("pos_compare: castle permissions are different\n");
         return false;
     }
 
-    if (first->state.en_passant_sq != second->state.en_passant_sq) {
+    if (first->snap->state.en_passant_sq != second->snap->state.en_passant_sq) {
         printf("pos_compare: en passant state is different\n");
         return false;
     }
@@ -547,7 +924,7 @@ bool pos_compare(const struct position *first, const struct position *second) {
 }
 
 uint64_t pos_get_hash(const struct position *const pos) {
-    return pos->state.hashkey;
+    return pos->snap->state.hashkey;
 }
 
 // ==================================================================
@@ -560,43 +937,137 @@ static void init_pos_struct(struct position *const pos) {
     memset(pos, 0, sizeof(struct position));
     pos->struct_init_key = STRUCT_INIT_KEY;
 
-    pos->state.castle_perm_container = cast_perm_init();
+    brd_initialise(&pos->own_snapshot.brd);
+    pos->snap = &pos->own_snapshot;
+    pos->snap->state.castle_perm_container = cast_perm_init();
 
+    pos->history.items = (struct history_item *)malloc(INITIAL_HISTORY_CAPACITY * sizeof(struct history_item));
+    if (pos->history.items == NULL) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Failed to allocate position history");
+    }
+    pos->history.capacity = INITIAL_HISTORY_CAPACITY;
     pos->history.num_used_slots = 0;
 }
 
 static void do_capture_move(struct position *const pos, enum square from_sq, enum square to_sq,
                             enum piece pce_to_move) {
     enum piece pce_capt;
-    brd_try_get_piece_on_square(pos->brd, to_sq, &pce_capt);
+    brd_try_get_piece_on_square(&pos->snap->brd, to_sq, &pce_capt);
 
     pos_remove_piece(pos, pce_capt, to_sq);
     pos_move_piece(pos, pce_to_move, from_sq, to_sq);
 }
 
-static enum move_legality get_move_legal_status(const struct position *const pos, struct move mov) {
-    const enum colour side_to_move = pos_get_side_to_move(pos);
+/**
+ * @brief Tests the legality of a pseudo-legal move before it's made
+ * @details Most moves only need the cached checkers and pinned pieces. King moves and en passant look at the
+ * attackers of the King square using the occupancy after the move.
+ */
+static enum move_legality get_move_legal_status(const struct position *const pos, struct move mv) {
+    const struct board *const brd = &pos->snap->brd;
+    const enum colour side_to_move = pos->snap->state.side_to_move;
     const enum colour attacking_side = pce_swap_side(side_to_move);
+    const uint64_t checkers = pos->snap->state.checkers;
 
-    const enum square king_sq = brd_get_king_square(pos_get_board(pos), side_to_move);
-
-    if (att_chk_is_sq_attacked(pos, king_sq, attacking_side)) {
-        // square attacked, move not legal
-        return ILLEGAL_MOVE;
+    if (move_is_castle(mv)) {
+        // can't castle out of, or through, check
+        if (checkers != 0 || !is_castle_move_legal(pos, mv, side_to_move, attacking_side)) {
+            return ILLEGAL_MOVE;
+        }
+        return LEGAL_MOVE;
     }
 
-    if (move_is_castle(mov)) {
-        // check that the castle wasn't done through attacked squares
-        if (is_castle_move_legal(pos, mov, side_to_move, attacking_side) == false) {
-            return ILLEGAL_MOVE;
+    const enum square from_sq = move_decode_from_sq(mv);
+    const enum square to_sq = move_decode_to_sq(mv);
+    const enum square king_sq = brd_get_king_square(brd, side_to_move);
+
+    if (from_sq != king_sq && !move_is_en_passant(mv)) {
+        if (checkers != 0) {
+            // double check, only the King can move
+            if ((checkers & (checkers - 1)) != 0) {
+                return ILLEGAL_MOVE;
+            }
+            // single check, capture the checker or block the line of attack
+            uint64_t checker_bb = checkers;
+            const enum square checker_sq = bb_pop_1st_bit_and_clear(&checker_bb);
+            if (to_sq != checker_sq && bb_is_clear(occ_mask_get_inbetween(king_sq, checker_sq), to_sq)) {
+                return ILLEGAL_MOVE;
+            }
+        }
+
+        if (bb_is_clear(pos->snap->state.pinned[side_to_move], from_sq)) {
+            return LEGAL_MOVE;
         }
+        // a pinned piece can only move along the line between the King and the pinning piece
+        const bool stays_on_pin_line = bb_is_set(occ_mask_get_inbetween(king_sq, from_sq), to_sq) ||
+                                       bb_is_set(occ_mask_get_inbetween(king_sq, to_sq), from_sq);
+        return stays_on_pin_line ? LEGAL_MOVE : ILLEGAL_MOVE;
     }
 
+    const uint64_t to_bb = SQUARE_AS_BITBOARD(to_sq);
+
+    uint64_t captured_bb = move_is_capture(mv) ? to_bb : 0;
+    if (move_is_en_passant(mv)) {
+        const enum square captured_sq =
+            side_to_move == WHITE ? sq_get_square_minus_1_rank(to_sq) : sq_get_square_plus_1_rank(to_sq);
+        captured_bb = SQUARE_AS_BITBOARD(captured_sq);
+    }
+
+    const uint64_t occupied_after_bb = (brd_get_board_bb(brd) & ~(SQUARE_AS_BITBOARD(from_sq) | captured_bb)) | to_bb;
+    const enum square king_sq_after = from_sq == king_sq ? to_sq : king_sq;
+
+    const uint64_t attackers_bb =
+        att_chk_attackers_to(pos, king_sq_after, occupied_after_bb) & brd_get_colour_bb(brd, attacking_side);
+    if ((attackers_bb & ~captured_bb) != 0) {
+        return ILLEGAL_MOVE;
+    }
     return LEGAL_MOVE;
 }
 
+/**
+ * @brief Recalculates the checkers and pinned pieces after the board or side to move has changed
+ */
+static void update_check_info(struct position *const pos) {
+    const struct board *const brd = &pos->snap->brd;
+    const enum colour side_to_move = pos->snap->state.side_to_move;
+    const enum square king_sq = brd_get_king_square(brd, side_to_move);
+
+    pos->snap->state.checkers = att_chk_attackers_to(pos, king_sq, brd_get_board_bb(brd)) &
+                          brd_get_colour_bb(brd, pce_swap_side(side_to_move));
+    pos->snap->state.pinned[WHITE] = get_pinned_pieces(brd, WHITE);
+    pos->snap->state.pinned[BLACK] = get_pinned_pieces(brd, BLACK);
+}
+
+static uint64_t get_pinned_pieces(const struct board *const brd, enum colour colour) {
+    const enum colour opposing_colour = pce_swap_side(colour);
+    const enum square king_sq = brd_get_king_square(brd, colour);
+
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t our_pce_bb = brd_get_colour_bb(brd, colour);
+    const uint64_t opposite_colour_bb = brd_get_colour_bb(brd, opposing_colour);
+    const uint64_t queen_bb = brd_get_bb_for_role_colour(brd, QUEEN, opposing_colour);
+    const uint64_t rook_queen_bb = brd_get_bb_for_role_colour(brd, ROOK, opposing_colour) | queen_bb;
+    const uint64_t bishop_queen_bb = brd_get_bb_for_role_colour(brd, BISHOP, opposing_colour) | queen_bb;
+
+    // opposing sliders lined up with the King, looking through our own pieces
+    uint64_t pinners_bb = (occ_mask_get_rook_attacks(king_sq, opposite_colour_bb) & rook_queen_bb) |
+                          (occ_mask_get_bishop_attacks(king_sq, opposite_colour_bb) & bishop_queen_bb);
+
+    uint64_t pinned_bb = 0;
+    while (pinners_bb != 0) {
+        const enum square pinner_sq = bb_pop_1st_bit_and_clear(&pinners_bb);
+        const uint64_t blockers_bb = occ_mask_get_inbetween(king_sq, pinner_sq) & occupied_sq_bb;
+
+        const bool single_blocker = blockers_bb != 0 && (blockers_bb & (blockers_bb - 1)) == 0;
+        if (single_blocker && (blockers_bb & our_pce_bb) != 0) {
+            pinned_bb |= blockers_bb;
+        }
+    }
+    return pinned_bb;
+}
+
 static void make_king_side_castle_move(struct position *const pos) {
-    switch (pos->state.side_to_move) {
+    switch (pos->snap->state.side_to_move) {
     case WHITE:
         pos_move_piece(pos, WHITE_KING, e1, g1);
         pos_move_piece(pos, WHITE_ROOK, h1, f1);
@@ -618,7 +1089,7 @@ static void make_king_side_castle_move(struct position *const pos) {
 }
 
 static void make_queen_side_castle_move(struct position *const pos) {
-    switch (pos->state.side_to_move) {
+    switch (pos->snap->state.side_to_move) {
     case WHITE:
         pos_move_piece(pos, WHITE_KING, e1, c1);
         pos_move_piece(pos, WHITE_ROOK, a1, d1);
@@ -645,7 +1116,7 @@ static void make_en_passant_move(struct position *const pos, enum square from_sq
     enum piece piece_to_move;
     enum square sq_with_piece;
 
-    if (pos->state.side_to_move == WHITE) {
+    if (pos->snap->state.side_to_move == WHITE) {
         sq_with_piece = sq_get_square_minus_1_rank(to_sq);
         piece_to_move = WHITE_PAWN;
         piece_to_remove = BLACK_PAWN;
@@ -657,15 +1128,16 @@ static void make_en_passant_move(struct position *const pos, enum square from_sq
 
     pos_remove_piece(pos, piece_to_remove, sq_with_piece);
     pos_move_piece(pos, piece_to_move, from_sq, to_sq);
-    pos->state.hashkey = hash_en_passant(to_sq, pos->state.hashkey);
+    pos->snap->state.hashkey = hash_en_passant(to_sq, pos->snap->state.hashkey);
 }
 
 static void populate_position_from_fen(struct position *const pos, const struct parsed_fen *fen) {
-    pos->state.side_to_move = fen_get_side_to_move(fen);
-    pos->state.en_passant_sq = fen_get_en_pass_sq(fen);
-    pos->state.fifty_move_counter = 0;
-    pos->state.ply = fen_get_half_move_cnt(fen);
-    pos->state.history_ply = fen_get_full_move_cnt(fen);
+    pos->snap->state.side_to_move = fen_get_side_to_move(fen);
+    pos->snap->state.en_passant_sq = fen_get_en_pass_sq(fen);
+    pos->snap->state.fifty_move_counter = fen_get_half_move_cnt(fen);
+    pos->snap->state.plies_since_null = fen_get_half_move_cnt(fen);
+    pos->snap->state.ply = fen_get_half_move_cnt(fen);
+    pos->snap->state.history_ply = fen_get_full_move_cnt(fen);
     set_up_castle_permissions(pos, fen);
 
     for (enum square sq = a1; sq <= h8; sq++) {
@@ -676,6 +1148,9 @@ static void populate_position_from_fen(struct position *const pos, const struct
             pos_add_piece(pos, pce, sq);
         }
     }
+
+    update_check_info(pos);
+    pos->attack_map_valid = false;
 }
 
 static void set_up_castle_permissions(struct position *const pos, const struct parsed_fen *fen) {
@@ -697,8 +1172,8 @@ static void set_up_castle_permissions(struct position *const pos, const struct p
 }
 
 static void pos_update_castle_perm(struct position *const pos, enum castle_permission perm, bool perm_state) {
-    cast_perm_set_permission(perm, &pos->state.castle_perm_container, perm_state);
-    pos->state.hashkey = hash_castle_perm(perm, pos->state.hashkey);
+    cast_perm_set_permission(perm, &pos->snap->state.castle_perm_container, perm_state);
+    pos->snap->state.hashkey = hash_castle_perm(perm, pos->snap->state.hashkey);
 }
 
 static enum square get_en_pass_sq(enum colour side, enum square from_sq) {
@@ -709,30 +1184,40 @@ static enum square get_en_pass_sq(enum colour side, enum square from_sq) {
     return retval;
 }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wcast-qual"
 static void position_hist_push(struct position *const pos, struct move mv, enum piece pce_moved,
                                enum piece captured_piece) {
 
     assert(validate_position_history(pos));
     assert(validate_move(mv));
-    assert(validate_piece(pce_moved));
+    // a null move doesn't move a piece
+    if (pce_moved != NO_PIECE) {
+        assert(validate_piece(pce_moved));
+    }
     if (captured_piece != NO_PIECE) {
         assert(validate_piece(captured_piece));
     }
-    assert(pos->history.num_used_slots < MAX_GAME_MOVES);
 
-    struct history_item *const free_slot = &pos->history.items[pos->history.num_used_slots];
+    if (pos->history.num_used_slots == pos->history.capacity) {
+        position_hist_grow(pos);
+    }
 
-    __builtin_memcpy_inline(&free_slot->state, &pos->state, sizeof(struct game_state));
+    struct history_item *const free_slot = &pos->history.items[pos->history.num_used_slots];
 
+    free_slot->hashkey = pos->snap->state.hashkey;
     free_slot->mv = mv;
-    free_slot->pce_moved = (enum piece)pce_moved;
-    free_slot->captured_piece = (enum piece)captured_piece;
-
+    free_slot->pce_moved = (uint8_t)pce_moved;
+    free_slot->captured_piece = (uint8_t)captured_piece;
+    free_slot->en_passant_sq = (uint8_t)pos->snap->state.en_passant_sq;
+    free_slot->fifty_move_counter = pos->snap->state.fifty_move_counter;
+    free_slot->plies_since_null = pos->snap->state.plies_since_null;
+    free_slot->castle_perm_container = pos->snap->state.castle_perm_container;
+    free_slot->checkers = pos->snap->state.checkers;
+    free_slot->pinned[WHITE] = pos->snap->state.pinned[WHITE];
+    free_slot->pinned[BLACK] = pos->snap->state.pinned[BLACK];
+
+    pos->history.repetition_filter[get_repetition_filter_index(pos->snap->state.hashkey)]++;
     pos->history.num_used_slots++;
 }
-#pragma GCC diagnostic pop
 
 static struct history_item position_hist_pop(struct position *const pos) {
     assert(validate_position_history(pos));
@@ -741,28 +1226,63 @@ static struct history_item position_hist_pop(struct position *const pos) {
 
     pos->history.num_used_slots--;
 
-    struct history_item *const free_slot = &pos->history.items[pos->history.num_used_slots];
-    __builtin_memcpy_inline(&pos->state, &free_slot->state, sizeof(struct game_state));
+    const struct history_item *const slot = &pos->history.items[pos->history.num_used_slots];
+
+    assert(pos->history.repetition_filter[get_repetition_filter_index(slot->hashkey)] > 0);
+    pos->history.repetition_filter[get_repetition_filter_index(slot->hashkey)]--;
+
+    // the side, ply and move counts are reversed, the rest is restored from the undo record
+    pos->snap->state.hashkey = slot->hashkey;
+    pos->snap->state.side_to_move = pce_swap_side(pos->snap->state.side_to_move);
+    pos->snap->state.ply--;
+    pos->snap->state.history_ply--;
+    pos->snap->state.fifty_move_counter = slot->fifty_move_counter;
+    pos->snap->state.plies_since_null = slot->plies_since_null;
+    pos->snap->state.en_passant_sq = (enum square)slot->en_passant_sq;
+    pos->snap->state.castle_perm_container = slot->castle_perm_container;
+    pos->snap->state.checkers = slot->checkers;
+    pos->snap->state.pinned[WHITE] = slot->pinned[WHITE];
+    pos->snap->state.pinned[BLACK] = slot->pinned[BLACK];
+
+    return *slot;
+}
+
+static void position_hist_grow(struct position *const pos) {
+    const uint32_t new_capacity = pos->history.capacity * 2;
+
+    struct history_item *const items =
+        (struct history_item *)realloc(pos->history.items, new_capacity * sizeof(struct history_item));
+    if (items == NULL) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Failed to grow position history");
+    }
+
+    pos->history.items = items;
+    pos->history.capacity = new_capacity;
+}
+
+static uint32_t get_repetition_filter_index(uint64_t hashkey) {
+    return (uint32_t)(hashkey & (REPETITION_FILTER_SIZE - 1));
+}
 
-    return pos->history.items[pos->history.num_used_slots];
+// how far back a repetition scan can look, captures, pawn moves and null moves all break the chain
+static uint32_t get_max_repetition_distance(const struct game_state *const state, uint32_t num_prev_positions) {
+    const uint32_t reversible_plies =
+        state->fifty_move_counter < state->plies_since_null ? state->fifty_move_counter : state->plies_since_null;
+    return reversible_plies < num_prev_positions ? reversible_plies : num_prev_positions;
 }
 
 #pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-variable"
 #pragma GCC diagnostic ignored "-Wunused-function"
 
 static bool validate_position_history(const struct position *const pos) {
-    const struct history_item *free_slot = &pos->history.items[pos->history.num_used_slots];
-
-    if (free_slot < &pos->history.items[0]) {
-        printf("Pos Hist free slot ptr is less than item[0], pos->history.num_used_slots=%d\n",
-               pos->history.num_used_slots);
+    if (pos->history.items == NULL) {
+        printf("Pos Hist items not allocated\n");
         return false;
     }
 
-    if (free_slot > &pos->history.items[MAX_GAME_MOVES - 1]) {
-        printf("Pos Hist free slot ptr is > item[MAX_GAME_MOVES - 1], pos->history.num_used_slots=%d\n",
-               pos->history.num_used_slots);
+    if (pos->history.num_used_slots > pos->history.capacity) {
+        printf("Pos Hist num_used_slots=%u is > capacity=%u\n", pos->history.num_used_slots,
+               pos->history.capacity);
         return false;
     }
 
@@ -776,15 +1296,14 @@ static bool position_hist_compare(const struct position *const pos1, const struc
         return false;
     }
 
-    uint16_t num_slots = pos1->history.num_used_slots;
+    const uint32_t num_slots = pos1->history.num_used_slots;
 
-    for (int i = 0; i < num_slots; i++) {
+    for (uint32_t i = 0; i < num_slots; i++) {
 
         const struct history_item *hi1 = &pos1->history.items[i];
         const struct history_item *hi2 = &pos2->history.items[i];
 
-        bool same_game_state = compare_game_states(&hi1->state, &hi2->state);
-        if (same_game_state == false) {
+        if (hi1->hashkey != hi2->hashkey) {
             return false;
         }
 
@@ -795,39 +1314,23 @@ static bool position_hist_compare(const struct position *const pos1, const struc
         if (hi1->captured_piece != hi2->captured_piece) {
             return false;
         }
-    }
-    return true;
-}
-
-static bool compare_game_states(const struct game_state *gs1, const struct game_state *gs2) {
-    if (gs1->hashkey != gs2->hashkey) {
-        return false;
-    }
-
-    if (gs1->side_to_move != gs2->side_to_move) {
-        return false;
-    }
 
-    if (gs1->ply != gs2->ply) {
-        return false;
-    }
-    if (gs1->history_ply != gs2->history_ply) {
-        return false;
-    }
+        if (hi1->en_passant_sq != hi2->en_passant_sq) {
+            return false;
+        }
 
-    if (gs1->fifty_move_counter != gs2->fifty_move_counter) {
-        return false;
-    }
+        if (hi1->fifty_move_counter != hi2->fifty_move_counter) {
+            return false;
+        }
 
-    if (gs1->en_passant_sq != gs2->en_passant_sq) {
-        return false;
-    }
+        if (hi1->plies_since_null != hi2->plies_since_null) {
+            return false;
+        }
 
-    bool same_cast_perms = cast_compare_perms(gs1->castle_perm_container, gs2->castle_perm_container);
-    if (same_cast_perms == false) {
-        return false;
+        if (cast_compare_perms(hi1->castle_perm_container, hi2->castle_perm_container) == false) {
+            return false;
+        }
     }
-
     return true;
 }
 
@@ -835,18 +1338,18 @@ static bool compare_game_states(const struct game_state *gs1, const struct game_
 // functions to manipulate pieces and update hashes
 //
 static void pos_move_piece(struct position *const pos, enum piece pce, enum square from_sq, enum square to_sq) {
-    brd_move_piece(pos->brd, pce, from_sq, to_sq);
-    pos->state.hashkey = hash_piece_update_move(pce, from_sq, to_sq, pos->state.hashkey);
+    brd_move_piece(&pos->snap->brd, pce, from_sq, to_sq);
+    pos->snap->state.hashkey = hash_piece_update_move(pce, from_sq, to_sq, pos->snap->state.hashkey);
 }
 
 static void pos_remove_piece(struct position *const pos, enum piece pce, enum square sq) {
-    brd_remove_piece(pos->brd, pce, sq);
-    pos->state.hashkey = hash_piece_update(pce, sq, pos->state.hashkey);
+    brd_remove_piece(&pos->snap->brd, pce, sq);
+    pos->snap->state.hashkey = hash_piece_update(pce, sq, pos->snap->state.hashkey);
 }
 
 static void pos_add_piece(struct position *const pos, enum piece pce, enum square sq) {
-    brd_add_piece(pos->brd, pce, sq);
-    pos->state.hashkey = hash_piece_update(pce, sq, pos->state.hashkey);
+    brd_add_piece(&pos->snap->brd, pce, sq);
+    pos->snap->state.hashkey = hash_piece_update(pce, sq, pos->snap->state.hashkey);
 }
 
 #pragma GCC diagnostic push
@@ -858,12 +1361,12 @@ static void reverse_castle_move(struct position *const pos, struct move mv, enum
     case WHITE:
         switch (mvt) {
         case MV_TYPE_KING_CASTLE:
-            brd_move_piece(pos->brd, WHITE_KING, g1, e1);
-            brd_move_piece(pos->brd, WHITE_ROOK, f1, h1);
+            brd_move_piece(&pos->snap->brd, WHITE_KING, g1, e1);
+            brd_move_piece(&pos->snap->brd, WHITE_ROOK, f1, h1);
             break;
         case MV_TYPE_QUEEN_CASTLE:
-            brd_move_piece(pos->brd, WHITE_KING, c1, e1);
-            brd_move_piece(pos->brd, WHITE_ROOK, d1, a1);
+            brd_move_piece(&pos->snap->brd, WHITE_KING, c1, e1);
+            brd_move_piece(&pos->snap->brd, WHITE_ROOK, d1, a1);
             break;
         default:
             print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "invalid castle type");
@@ -873,12 +1376,12 @@ static void reverse_castle_move(struct position *const pos, struct move mv, enum
     case BLACK:
         switch (mvt) {
         case MV_TYPE_KING_CASTLE:
-            brd_move_piece(pos->brd, BLACK_KING, g8, e8);
-            brd_move_piece(pos->brd, BLACK_ROOK, f8, h8);
+            brd_move_piece(&pos->snap->brd, BLACK_KING, g8, e8);
+            brd_move_piece(&pos->snap->brd, BLACK_ROOK, f8, h8);
             break;
         case MV_TYPE_QUEEN_CASTLE:
-            brd_move_piece(pos->brd, BLACK_KING, c8, e8);
-            brd_move_piece(pos->brd, BLACK_ROOK, d8, a8);
+            brd_move_piece(&pos->snap->brd, BLACK_KING, c8, e8);
+            brd_move_piece(&pos->snap->brd, BLACK_ROOK, d8, a8);
             break;
         default:
             print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid castle type");
@@ -897,7 +1400,7 @@ static void update_castle_perms(struct position *const pos, struct move mv, enum
         return;
     }
 
-    const struct cast_perm_container cpc = pos->state.castle_perm_container;
+    const struct cast_perm_container cpc = pos->snap->state.castle_perm_container;
     if (!cast_perm_has_permissions(cpc)) {
         return;
     }
@@ -1035,3 +1538,85 @@ static bool is_castle_move_legal(const struct position *const pos, struct move m
 }
 
 #pragma GCC diagnostic pop
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+
+static bool is_pawn_move_pseudo_legal(const struct position *const pos, struct move mv, enum colour side_to_move) {
+    const struct board *const brd = pos_get_board(pos);
+
+    const enum square from_sq = move_decode_from_sq(mv);
+    const enum square to_sq = move_decode_to_sq(mv);
+
+    const uint64_t occupied_sq_bb = brd_get_board_bb(brd);
+    const uint64_t opposite_colour_bb = brd_get_colour_bb(brd, pce_swap_side(side_to_move));
+
+    const bool is_white = side_to_move == WHITE;
+    const enum rank promotion_rank = is_white ? RANK_8 : RANK_1;
+    const enum rank double_move_rank = is_white ? RANK_2 : RANK_7;
+    const uint64_t capture_bb = is_white ? occ_mask_get_white_pawn_capture_non_first_double_move(from_sq)
+                                         : occ_mask_get_black_pawn_capture_non_first_double_move(from_sq);
+
+    // a pawn move to the last rank must be a promotion, and vice versa
+    if (move_is_promotion(mv) != (sq_get_rank(to_sq) == promotion_rank)) {
+        return false;
+    }
+
+    const enum move_type mv_type = move_get_move_type(mv);
+    switch (mv_type) {
+    case MV_TYPE_QUIET:
+    case MV_TYPE_PROMOTE_KNIGHT:
+    case MV_TYPE_PROMOTE_BISHOP:
+    case MV_TYPE_PROMOTE_ROOK:
+    case MV_TYPE_PROMOTE_QUEEN: {
+        const enum square push_sq = is_white ? sq_get_square_plus_1_rank(from_sq) : sq_get_square_minus_1_rank(from_sq);
+        return to_sq == push_sq && bb_is_clear(occupied_sq_bb, to_sq);
+    }
+    case MV_TYPE_DOUBLE_PAWN: {
+        if (sq_get_rank(from_sq) != double_move_rank) {
+            return false;
+        }
+        // the mask holds both the square passed over and the target, which must be two ranks ahead
+        const enum square target_sq =
+            is_white ? sq_get_square_plus_2_rank(from_sq) : sq_get_square_minus_2_rank(from_sq);
+        const uint64_t double_bb = is_white ? occ_mask_get_double_pawn_mask_white(from_sq)
+                                            : occ_mask_get_double_pawn_mask_black(from_sq);
+        return to_sq == target_sq && (double_bb & occupied_sq_bb) == 0;
+    }
+    case MV_TYPE_CAPTURE:
+    case MV_TYPE_PROMOTE_KNIGHT_CAPTURE:
+    case MV_TYPE_PROMOTE_BISHOP_CAPTURE:
+    case MV_TYPE_PROMOTE_ROOK_CAPTURE:
+    case MV_TYPE_PROMOTE_QUEEN_CAPTURE:
+        return bb_is_set(capture_bb, to_sq) && bb_is_set(opposite_colour_bb, to_sq);
+    case MV_TYPE_EN_PASS:
+        return pos_is_en_passant_active(pos) && to_sq == pos_get_en_pass_sq(pos) && bb_is_set(capture_bb, to_sq);
+    default:
+        return false;
+    }
+}
+
+static bool is_castle_move_pseudo_legal(const struct position *const pos, struct move mv, enum colour side_to_move) {
+    const struct cast_perm_container cp = pos_get_cast_perm(pos);
+    const uint64_t occupied_sq_bb = brd_get_board_bb(pos_get_board(pos));
+
+    // squares between the King and Rook must be empty
+    const bool is_white = side_to_move == WHITE;
+    if (move_is_king_castle(mv)) {
+        const bool has_perm =
+            is_white ? cast_perm_has_white_kingside_permissions(cp) : cast_perm_has_black_kingside_permissions(cp);
+        const uint64_t between_bb = is_white ? occ_mask_get_inbetween(e1, h1) : occ_mask_get_inbetween(e8, h8);
+        return has_perm && move_compare(mv, is_white ? move_encode_castle_kingside_white()
+                                                     : move_encode_castle_kingside_black()) &&
+               (between_bb & occupied_sq_bb) == 0;
+    }
+
+    const bool has_perm =
+        is_white ? cast_perm_has_white_queenside_permissions(cp) : cast_perm_has_black_queenside_permissions(cp);
+    const uint64_t between_bb = is_white ? occ_mask_get_inbetween(e1, a1) : occ_mask_get_inbetween(e8, a8);
+    return has_perm &&
+           move_compare(mv, is_white ? move_encode_castle_queenside_white() : move_encode_castle_queenside_black()) &&
+           (between_bb & occupied_sq_bb) == 0;
+}
+
+#pragma GCC diagnostic pop
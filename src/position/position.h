@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "board.h"
 #include "castle_perms.h"
 #include "move.h"
 #include "piece.h"
@@ -37,8 +38,41 @@
 #include <string.h>
 
 struct position;
+struct attack_map;
 
-#define MAX_GAME_MOVES (1024)
+struct game_state {
+    // position hash
+    uint64_t hashkey;
+
+    // the next side to move
+    enum colour side_to_move;
+
+    // keeping track of ply
+    uint16_t ply;         // half-moves
+    uint16_t history_ply; // full move count
+
+    uint16_t fifty_move_counter;
+    // half-moves since the last null move (or since the position was set up), repetitions can't span a
+    // null move
+    uint16_t plies_since_null;
+
+    enum square en_passant_sq;
+
+    // active catle permissions
+    struct cast_perm_container castle_perm_container;
+
+    // pieces giving check to the side to move
+    uint64_t checkers;
+    // for each colour, the pieces pinned against their own King
+    uint64_t pinned[NUM_COLOURS];
+};
+
+// the board and game state of a position, without its move history. Holds no pointers, so it can be
+// copied with memcpy; used for copy-make, see pos_make_move_copy()
+struct pos_snapshot {
+    struct board brd;
+    struct game_state state;
+};
 
 // clang-format off
 
@@ -64,7 +98,25 @@ bool pos_is_en_passant_active(const struct position *const pos);
 enum colour pos_get_side_to_move(const struct position *const pos);
 
 enum move_legality pos_make_move(struct position *const pos, struct move mv);
+void pos_make_legal_move(struct position *const pos, struct move mv);
+void pos_save_snapshot(const struct position *const pos, struct pos_snapshot *const snap);
+void pos_attach_snapshot(struct position *const pos, struct pos_snapshot *const snap);
+enum move_legality pos_make_move_copy(const struct pos_snapshot *const src, struct pos_snapshot *const dst,
+                                      struct move mv);
+bool pos_is_snapshot_repetition(const struct pos_snapshot *const snap, const uint64_t *const hashes,
+                                uint32_t num_hashes);
+bool pos_is_pseudo_legal(const struct position *const pos, struct move mv);
+bool pos_is_legal(const struct position *const pos, struct move mv);
+uint64_t pos_get_checkers(const struct position *const pos);
+uint64_t pos_get_pinned(const struct position *const pos, enum colour colour);
+bool pos_is_in_check(const struct position *const pos);
+const struct attack_map *pos_get_attack_map(struct position *const pos);
+bool pos_is_repetition(const struct position *const pos);
+bool pos_is_fifty_move_draw(const struct position *const pos);
+uint16_t pos_get_fifty_move_counter(const struct position *const pos);
 struct move pos_take_move(struct position *const pos);
+void pos_make_null_move(struct position *const pos);
+void pos_take_null_move(struct position *const pos);
 
 bool validate_position(const struct position *const pos);
 bool pos_compare(const struct position *const first, const struct position *const second);
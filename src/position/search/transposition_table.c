@@ -30,35 +30,150 @@
  * @{
  * @details Used to maintain the sequence of best moves
  *
+ * The table is made up of 64-byte buckets, aligned to a cache line, each holding
+ * TT_ENTRIES_PER_BUCKET entries. A position hash selects a bucket, so a probe costs a single
+ * cache miss and checks all the entries in it. When adding to a full bucket, the entry with the
+ * lowest depth, adjusted for how many searches ago it was written, is replaced.
+ *
+ * The table can be any size; a hash is mapped to a bucket by taking the high 64 bits of the
+ * 128-bit product of the hash and the number of buckets, avoiding a division on every probe.
+ * See https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
+ *
+ * The table can be shared by multiple search threads without locking. Each entry is two 64-bit
+ * words, written and read atomically, with the position hash stored XOR'd with the data word.
+ * If two threads write the same entry at once, the words can end up from different writes, but
+ * the XOR of the two words then won't match the position hash, so a reader treats the entry as
+ * a miss rather than returning another position's data.
+ * See https://www.chessprogramming.org/Shared_Hash_Table#Lockless
+ *
+ * On Linux, tables of at least a huge page are mapped using explicit huge pages (hugetlbfs) if any
+ * are reserved, otherwise with transparent huge pages requested via madvise(), to reduce TLB misses
+ * when probing. The huge page sizes are read from the kernel rather than assumed. Smaller tables,
+ * or other platforms, use the heap. Clearing the table is split across multiple threads.
+ *
  */
 
+// for MAP_ANONYMOUS, MAP_HUGETLB and MADV_HUGEPAGE
+#define _GNU_SOURCE
+
 #include <assert.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#define HUGE_PAGES_AVAILABLE
+#endif
 
 #include "hashkeys.h"
 #include "search.h"
 #include "transposition_table.h"
 #include "utils.h"
 
-#define MIN_NUM_TT_SLOTS 1000000
+#define MIN_TT_SIZE_IN_BYTES ((uint64_t)(1024 * 1024))
+#define CACHE_LINE_SIZE 64
 
-static void set_tt_size(uint64_t size_in_bytes);
-static void init_table(void);
-static uint32_t get_index(const uint64_t hash);
-static bool validate_node_type(const enum node_type nt);
+// used when the kernel doesn't report the transparent huge page size
+#define DEFAULT_HUGE_PAGE_SIZE ((size_t)(2 * 1024 * 1024))
+
+// each thread clears at least this many bytes, so small tables are cleared by the calling thread
+#define MIN_CLEAR_BYTES_PER_THREAD ((size_t)(64 * 1024 * 1024))
+#define MAX_CLEAR_THREADS 64
+
+// Packed entry data (64 bits)
+//
+//  bits 0..15      move
+//  bits 16..47     score
+//  bits 48..55     depth
+//  bits 56..57     node type + 1 (0 means the entry is unused)
+//  bits 58..63     search generation
+//
+// clang-format off
+#define DATA_SCORE_SHIFT        16
+#define DATA_DEPTH_SHIFT        48
+#define DATA_NODE_TYPE_SHIFT    56
+#define DATA_GENERATION_SHIFT   58
+
+#define DATA_MOVE_MASK          ((uint64_t)0xFFFF)
+#define DATA_SCORE_MASK         ((uint64_t)0xFFFFFFFF)
+#define DATA_DEPTH_MASK         ((uint64_t)0xFF)
+#define DATA_NODE_TYPE_MASK     ((uint64_t)0x03)
+#define DATA_GENERATION_MASK    ((uint64_t)0x3F)
+
+// when choosing an entry to replace, each search since the entry was written counts as this many plies of depth
+#define AGE_DEPTH_WEIGHT        4
+// clang-format on
 
 struct tt_entry {
-    uint64_t position_hash;
-    struct move mv;
-    int32_t score;
-    uint8_t depth;
-    bool slot_used;
-    enum node_type node_type;
+    _Atomic uint64_t hash_xor_data;
+    _Atomic uint64_t data;
+};
+
+struct tt_bucket {
+    struct tt_entry entries[TT_ENTRIES_PER_BUCKET];
+};
+
+_Static_assert(sizeof(struct tt_bucket) == CACHE_LINE_SIZE, "TT bucket should fill a cache line");
+
+__extension__ typedef unsigned __int128 uint128_t;
+
+enum tt_alloc_type {
+    TT_ALLOC_NONE,
+    TT_ALLOC_HEAP,
+    TT_ALLOC_HUGETLB,
+    TT_ALLOC_MMAP,
 };
 
-// num entries in TT
-static uint32_t num_tt_elems = 0;
-// ptr to transposition table
-static struct tt_entry *tt = NULL;
+struct clear_job {
+    uint8_t *start;
+    size_t num_bytes;
+};
+
+static void allocate_table(const uint64_t num_buckets);
+static void allocate_from_heap(const size_t size_in_bytes);
+static void init_table(void);
+static void *clear_memory(void *arg);
+static size_t get_num_clear_threads(const size_t num_bytes);
+static size_t get_system_page_size(void);
+#if defined(HUGE_PAGES_AVAILABLE)
+static bool allocate_huge_pages(const size_t size_in_bytes);
+static bool is_transparent_huge_page_backed(const void *addr);
+static size_t get_hugetlb_page_size(void);
+static size_t get_transparent_huge_page_size(void);
+static size_t round_up_to_page(const size_t size_in_bytes, const size_t page_size);
+#endif
+static uint64_t get_num_buckets(uint64_t size_in_bytes);
+static uint64_t get_index(const uint64_t hash);
+static uint64_t pack_data(const struct move mv, const uint8_t depth, const int32_t score,
+                          const enum node_type node_type);
+static struct move get_move(const uint64_t data);
+static uint8_t get_depth(const uint64_t data);
+static uint8_t get_generation(const uint64_t data);
+static bool is_entry_used(const uint64_t data);
+static int get_replacement_value(const uint64_t data);
+static void load_entry(const struct tt_entry *const entry, uint64_t *position_hash, uint64_t *data);
+static void store_entry(struct tt_entry *const entry, const uint64_t position_hash, const uint64_t data);
+static bool validate_node_type(const enum node_type nt);
+
+// num buckets in TT
+static uint64_t num_tt_buckets = 0;
+// ptr to transposition table, aligned to a cache line
+static struct tt_bucket *tt = NULL;
+// ptr to underlying allocation, its size, and the number of buckets it can hold
+static void *tt_alloc = NULL;
+static size_t tt_alloc_size = 0;
+static uint64_t num_alloc_buckets = 0;
+static enum tt_alloc_type tt_alloc_type = TT_ALLOC_NONE;
+// size of the memory pages backing the table
+static size_t tt_page_size_in_bytes = 0;
+// current search generation, stored in each entry. Only changed between searches.
+static uint8_t generation = 0;
+
+// number of threads used to clear the table, 0 to choose based on the table size and CPU count
+static size_t clear_threads_override = 0;
 
 /**
  * @brief Create an initialise the Transposition Table
@@ -66,15 +181,31 @@ static struct tt_entry *tt = NULL;
  * @param size_in_bytes The size in bytes of the Transposition Table
  */
 void tt_create(uint64_t size_in_bytes) {
-    if (size_in_bytes < sizeof(struct tt_entry)) {
-        printf("Required TT size is too small...setting to %d\n", MIN_NUM_TT_SLOTS);
-    }
-
     if (tt != NULL) {
         tt_dispose();
     }
 
-    set_tt_size(size_in_bytes);
+    allocate_table(get_num_buckets(size_in_bytes));
+
+    init_table();
+}
+
+/**
+ * @brief Resizes and clears the Transposition Table
+ * 
+ * @details The existing allocation is reused if it's large enough, otherwise a new table is allocated
+ * 
+ * @param size_in_bytes The new size in bytes of the Transposition Table
+ */
+void tt_resize(uint64_t size_in_bytes) {
+    const uint64_t num_buckets = get_num_buckets(size_in_bytes);
+
+    if (tt == NULL || num_buckets > num_alloc_buckets) {
+        tt_dispose();
+        allocate_table(num_buckets);
+    } else {
+        num_tt_buckets = num_buckets;
+    }
 
     init_table();
 }
@@ -82,19 +213,51 @@ void tt_create(uint64_t size_in_bytes) {
 /**
  * @brief Returns the number of TT elements in the table
  * 
- * @return uint32_t The number of elements
+ * @return uint64_t The number of elements
  */
-uint32_t tt_capacity(void) {
-    return num_tt_elems;
+uint64_t tt_capacity(void) {
+    return num_tt_buckets * TT_ENTRIES_PER_BUCKET;
 }
 
 size_t tt_entry_size(void) {
     return sizeof(struct tt_entry);
 }
 
+/**
+ * @brief Returns the size of the memory pages backing the TT, eg to confirm huge pages were obtained
+ * 
+ * @return size_t The page size in bytes, or 0 if there is no table
+ */
+size_t tt_page_size(void) {
+    return tt_page_size_in_bytes;
+}
+
+/**
+ * @brief               Overrides the number of threads used to clear the table
+ * @details             Intended for testing, so the parallel clear can be exercised with small tables and on
+ *                      single CPU machines. The count is still limited to one thread per bucket.
+ *
+ * @param num_threads   The number of threads, or 0 to choose based on the table size and CPU count
+ */
+void tt_set_clear_threads(size_t num_threads) {
+    clear_threads_override = num_threads > MAX_CLEAR_THREADS ? MAX_CLEAR_THREADS : num_threads;
+}
+
+/**
+ * @brief Starts a new search generation. Entries from earlier searches become preferred for replacement
+ * 
+ */
+void tt_new_search(void) {
+    generation = (uint8_t)((generation + 1) & DATA_GENERATION_MASK);
+}
+
 /**
  * @brief Adds the given search info to the TT table
  * 
+ * @details If the position is already in the table, it's only replaced with a search of at least the 
+ * same depth, or if the existing entry is from an earlier search. Otherwise, an unused entry in the
+ * bucket is taken, or failing that, the entry with the lowest age-adjusted depth is replaced.
+ * 
  * @param position_hash The position hash
  * @param mv The move
  * @param depth The search depth
@@ -108,25 +271,43 @@ bool tt_add(const uint64_t position_hash, const struct move mv, const uint8_t de
     assert(validate_move(mv));
     assert(validate_node_type(node_type));
     assert(tt != NULL);
-    assert(num_tt_elems > 0);
+    assert(num_tt_buckets > 0);
     assert(depth <= MAX_SEARCH_DEPTH);
 
-    const uint32_t hash_idx = get_index(position_hash);
-    struct tt_entry *entry = &tt[hash_idx];
+    struct tt_bucket *bucket = &tt[get_index(position_hash)];
+
+    struct tt_entry *replace = NULL;
+    int replace_value = INT_MAX;
+
+    for (int i = 0; i < TT_ENTRIES_PER_BUCKET; i++) {
+        struct tt_entry *entry = &bucket->entries[i];
+
+        uint64_t entry_hash = 0;
+        uint64_t entry_data = 0;
+        load_entry(entry, &entry_hash, &entry_data);
+
+        if (!is_entry_used(entry_data)) {
+            replace = entry;
+            break;
+        }
+
+        if (entry_hash == position_hash) {
+            // same position, only add if depth is at least as great, or the entry is stale
+            if (get_depth(entry_data) > depth && get_generation(entry_data) == generation) {
+                return false;
+            }
+            replace = entry;
+            break;
+        }
 
-    if (entry->slot_used == true) {
-        // slot is filled, only add if depth is greater
-        if (entry->depth > depth) {
-            return false;
+        const int value = get_replacement_value(entry_data);
+        if (value < replace_value) {
+            replace = entry;
+            replace_value = value;
         }
     }
 
-    entry->position_hash = position_hash;
-    entry->mv = mv;
-    entry->depth = depth;
-    entry->slot_used = true;
-    entry->score = score;
-    entry->node_type = node_type;
+    store_entry(replace, position_hash, pack_data(mv, depth, score, node_type));
     return true;
 }
 
@@ -139,13 +320,17 @@ bool tt_add(const uint64_t position_hash, const struct move mv, const uint8_t de
  * @return false if the has is not present
  */
 bool tt_probe_position(const uint64_t position_hash, struct move *mv) {
-    const uint32_t hash_idx = get_index(position_hash);
+    const struct tt_bucket *bucket = &tt[get_index(position_hash)];
 
-    const struct tt_entry *elem = &tt[hash_idx];
+    for (int i = 0; i < TT_ENTRIES_PER_BUCKET; i++) {
+        uint64_t entry_hash = 0;
+        uint64_t entry_data = 0;
+        load_entry(&bucket->entries[i], &entry_hash, &entry_data);
 
-    if (elem->position_hash == position_hash) {
-        *mv = elem->mv;
-        return true;
+        if (entry_hash == position_hash && is_entry_used(entry_data)) {
+            *mv = get_move(entry_data);
+            return true;
+        }
     }
     return false;
 }
@@ -156,32 +341,327 @@ bool tt_probe_position(const uint64_t position_hash, struct move *mv) {
  */
 void tt_dispose(void) {
     if (tt != NULL) {
-        free(tt);
+        switch (tt_alloc_type) {
+        case TT_ALLOC_HEAP:
+            free(tt_alloc);
+            break;
+        case TT_ALLOC_HUGETLB:
+        case TT_ALLOC_MMAP:
+#if defined(HUGE_PAGES_AVAILABLE)
+            munmap(tt_alloc, tt_alloc_size);
+#endif
+            break;
+        case TT_ALLOC_NONE:
+        default:
+            print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Invalid TT allocation type");
+            break;
+        }
 
         tt = NULL;
-        num_tt_elems = 0;
+        tt_alloc = NULL;
+        tt_alloc_size = 0;
+        tt_alloc_type = TT_ALLOC_NONE;
+        tt_page_size_in_bytes = 0;
+        num_tt_buckets = 0;
+        num_alloc_buckets = 0;
     }
 }
 
-static void set_tt_size(uint64_t size_in_bytes) {
-    num_tt_elems = (uint32_t)(size_in_bytes / sizeof(struct tt_entry));
+static uint64_t get_num_buckets(uint64_t size_in_bytes) {
+    if (size_in_bytes < MIN_TT_SIZE_IN_BYTES) {
+        printf("Requested TT size of %llu bytes is too small...using %llu bytes\n", (unsigned long long)size_in_bytes,
+               (unsigned long long)MIN_TT_SIZE_IN_BYTES);
+        size_in_bytes = MIN_TT_SIZE_IN_BYTES;
+    }
+    return size_in_bytes / sizeof(struct tt_bucket);
+}
+
+static void allocate_table(const uint64_t num_buckets) {
+    if (num_buckets >= SIZE_MAX / sizeof(struct tt_bucket)) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "TT size exceeds addressable memory");
+    }
+
+    const size_t size_in_bytes = (size_t)num_buckets * sizeof(struct tt_bucket);
 
-    if (num_tt_elems <= MIN_NUM_TT_SLOTS) {
-        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Insufficient number of TT slots");
+#if defined(HUGE_PAGES_AVAILABLE)
+    if (!allocate_huge_pages(size_in_bytes)) {
+        allocate_from_heap(size_in_bytes);
     }
+#else
+    allocate_from_heap(size_in_bytes);
+#endif
 
-    tt = (struct tt_entry *)calloc(num_tt_elems, sizeof(struct tt_entry));
+    num_tt_buckets = num_buckets;
+    num_alloc_buckets = num_buckets;
 }
 
+static void allocate_from_heap(const size_t size_in_bytes) {
+    // over-allocate by a bucket so the table can be aligned to a cache line
+    tt_alloc_size = size_in_bytes + sizeof(struct tt_bucket);
+    tt_alloc = malloc(tt_alloc_size);
+    if (tt_alloc == NULL) {
+        print_stacktrace_and_exit(__FILE__, __LINE__, __FUNCTION__, "Failed to allocate TT");
+    }
+
+    const uintptr_t aligned = ((uintptr_t)tt_alloc + CACHE_LINE_SIZE - 1) & ~(uintptr_t)(CACHE_LINE_SIZE - 1);
+    tt = (struct tt_bucket *)aligned;
+    tt_alloc_type = TT_ALLOC_HEAP;
+    tt_page_size_in_bytes = get_system_page_size();
+}
+
+#if defined(HUGE_PAGES_AVAILABLE)
+static bool allocate_huge_pages(const size_t size_in_bytes) {
+    // explicit huge pages, only available if they've been reserved (eg via /proc/sys/vm/nr_hugepages). The
+    // mapping uses the default huge page size, and its length must be a multiple of it.
+    const size_t hugetlb_page_size = get_hugetlb_page_size();
+    if (hugetlb_page_size > 0 && size_in_bytes >= hugetlb_page_size) {
+        const size_t rounded_size = round_up_to_page(size_in_bytes, hugetlb_page_size);
+
+        void *mem =
+            mmap(NULL, rounded_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mem != MAP_FAILED) {
+            tt_alloc = mem;
+            tt_alloc_size = rounded_size;
+            tt = (struct tt_bucket *)mem;
+            tt_alloc_type = TT_ALLOC_HUGETLB;
+            tt_page_size_in_bytes = hugetlb_page_size;
+            return true;
+        }
+    }
+
+    // otherwise, map normal pages and ask for transparent huge pages. Over-map so the
+    // table can start on a huge page boundary, then unmap the unused ends.
+    const size_t huge_page_size = get_transparent_huge_page_size();
+    if (size_in_bytes < huge_page_size) {
+        return false;
+    }
+
+    const size_t rounded_size = round_up_to_page(size_in_bytes, huge_page_size);
+    const size_t map_size = rounded_size + huge_page_size;
+    void *mem = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        return false;
+    }
+
+    const uintptr_t start = (uintptr_t)mem;
+    const uintptr_t aligned = (start + huge_page_size - 1) & ~(uintptr_t)(huge_page_size - 1);
+    const size_t head = (size_t)(aligned - start);
+    const size_t tail = map_size - head - rounded_size;
+    if (head > 0) {
+        munmap(mem, head);
+    }
+    if (tail > 0) {
+        munmap((void *)(aligned + rounded_size), tail);
+    }
+
+    // not fatal if it fails, the table will just use normal pages
+    madvise((void *)aligned, rounded_size, MADV_HUGEPAGE);
+
+    tt_alloc = (void *)aligned;
+    tt_alloc_size = rounded_size;
+    tt = (struct tt_bucket *)aligned;
+    tt_alloc_type = TT_ALLOC_MMAP;
+    // confirmed once the pages are touched when clearing the table
+    tt_page_size_in_bytes = get_system_page_size();
+    return true;
+}
+
+// Checks /proc/self/smaps to see if the kernel has backed the mapping starting at the given address
+// with any transparent huge pages
+static bool is_transparent_huge_page_backed(const void *addr) {
+    FILE *smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == NULL) {
+        return false;
+    }
+
+    char line[256];
+    bool in_mapping = false;
+    bool found = false;
+
+    while (fgets(line, sizeof(line), smaps) != NULL) {
+        unsigned long long start = 0;
+        unsigned long long end = 0;
+        if (sscanf(line, "%llx-%llx ", &start, &end) == 2) {
+            // start of a new mapping
+            if (in_mapping) {
+                break;
+            }
+            in_mapping = (start == (unsigned long long)(uintptr_t)addr);
+            continue;
+        }
+
+        unsigned long long huge_kb = 0;
+        if (in_mapping && sscanf(line, "AnonHugePages: %llu kB", &huge_kb) == 1) {
+            found = huge_kb > 0;
+            break;
+        }
+    }
+
+    fclose(smaps);
+    return found;
+}
+
+// Reads the default size of explicit (hugetlbfs) huge pages from /proc/meminfo, returns 0 if it isn't reported
+static size_t get_hugetlb_page_size(void) {
+    FILE *meminfo = fopen("/proc/meminfo", "r");
+    if (meminfo == NULL) {
+        return 0;
+    }
+
+    char line[256];
+    size_t page_size = 0;
+
+    while (fgets(line, sizeof(line), meminfo) != NULL) {
+        unsigned long long size_kb = 0;
+        if (sscanf(line, "Hugepagesize: %llu kB", &size_kb) == 1) {
+            page_size = (size_t)size_kb * 1024;
+            break;
+        }
+    }
+
+    fclose(meminfo);
+    return page_size;
+}
+
+// Reads the transparent huge page size from sysfs, falling back to the x86-64 size if it isn't reported
+static size_t get_transparent_huge_page_size(void) {
+    FILE *pmd_size = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (pmd_size == NULL) {
+        return DEFAULT_HUGE_PAGE_SIZE;
+    }
+
+    unsigned long long size_in_bytes = 0;
+    const bool found = fscanf(pmd_size, "%llu", &size_in_bytes) == 1 && size_in_bytes > 0;
+
+    fclose(pmd_size);
+    return found ? (size_t)size_in_bytes : DEFAULT_HUGE_PAGE_SIZE;
+}
+
+static size_t round_up_to_page(const size_t size_in_bytes, const size_t page_size) {
+    return ((size_in_bytes + page_size - 1) / page_size) * page_size;
+}
+#endif
+
 static void init_table(void) {
-    for (uint64_t i = 0; i < num_tt_elems; i++) {
-        struct tt_entry *entry = &tt[i];
-        entry->slot_used = false;
+    uint8_t *const start = (uint8_t *)tt;
+    const size_t num_bytes = (size_t)num_tt_buckets * sizeof(struct tt_bucket);
+
+    const size_t num_threads = get_num_clear_threads(num_bytes);
+
+    if (num_threads <= 1) {
+        memset(start, 0, num_bytes);
+    } else {
+        // split on bucket boundaries
+        const size_t chunk_size = (num_tt_buckets / num_threads) * sizeof(struct tt_bucket);
+
+        pthread_t threads[MAX_CLEAR_THREADS];
+        struct clear_job jobs[MAX_CLEAR_THREADS];
+        bool started[MAX_CLEAR_THREADS] = {false};
+
+        for (size_t i = 0; i < num_threads; i++) {
+            jobs[i].start = start + (i * chunk_size);
+            jobs[i].num_bytes = (i == num_threads - 1) ? num_bytes - (i * chunk_size) : chunk_size;
+
+            started[i] = pthread_create(&threads[i], NULL, clear_memory, &jobs[i]) == 0;
+            if (!started[i]) {
+                // clear it on this thread instead
+                clear_memory(&jobs[i]);
+            }
+        }
+        for (size_t i = 0; i < num_threads; i++) {
+            if (started[i]) {
+                pthread_join(threads[i], NULL);
+            }
+        }
     }
+    generation = 0;
+
+#if defined(HUGE_PAGES_AVAILABLE)
+    if (tt_alloc_type == TT_ALLOC_MMAP && is_transparent_huge_page_backed(tt_alloc)) {
+        tt_page_size_in_bytes = get_transparent_huge_page_size();
+    }
+#endif
+}
+
+static size_t get_num_clear_threads(const size_t num_bytes) {
+    size_t num_threads = clear_threads_override;
+
+    if (num_threads == 0) {
+        const long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = num_bytes / MIN_CLEAR_BYTES_PER_THREAD;
+        if (num_cpus > 0 && num_threads > (size_t)num_cpus) {
+            num_threads = (size_t)num_cpus;
+        }
+        if (num_threads > MAX_CLEAR_THREADS) {
+            num_threads = MAX_CLEAR_THREADS;
+        }
+    }
+
+    // every thread clears at least one bucket
+    if (num_threads > num_tt_buckets) {
+        num_threads = (size_t)num_tt_buckets;
+    }
+    return num_threads;
+}
+
+static void *clear_memory(void *arg) {
+    const struct clear_job *job = (const struct clear_job *)arg;
+    memset(job->start, 0, job->num_bytes);
+    return NULL;
+}
+
+static size_t get_system_page_size(void) {
+    const long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (size_t)page_size : 4096;
+}
+
+static uint64_t get_index(const uint64_t hash) {
+    // maps the hash onto [0, num_tt_buckets) using the high half of a 64x64 bit multiply
+    return (uint64_t)(((uint128_t)hash * num_tt_buckets) >> 64);
+}
+
+static uint64_t pack_data(const struct move mv, const uint8_t depth, const int32_t score,
+                          const enum node_type node_type) {
+    const uint64_t node_type_bits = (uint64_t)node_type + 1;
+
+    return (uint64_t)mv.bitmap | (((uint64_t)(uint32_t)score & DATA_SCORE_MASK) << DATA_SCORE_SHIFT) |
+           ((uint64_t)depth << DATA_DEPTH_SHIFT) | (node_type_bits << DATA_NODE_TYPE_SHIFT) |
+           ((uint64_t)generation << DATA_GENERATION_SHIFT);
+}
+
+static struct move get_move(const uint64_t data) {
+    const struct move mv = {.bitmap = (uint16_t)(data & DATA_MOVE_MASK)};
+    return mv;
+}
+
+static uint8_t get_depth(const uint64_t data) {
+    return (uint8_t)((data >> DATA_DEPTH_SHIFT) & DATA_DEPTH_MASK);
+}
+
+static uint8_t get_generation(const uint64_t data) {
+    return (uint8_t)((data >> DATA_GENERATION_SHIFT) & DATA_GENERATION_MASK);
+}
+
+static bool is_entry_used(const uint64_t data) {
+    return ((data >> DATA_NODE_TYPE_SHIFT) & DATA_NODE_TYPE_MASK) != 0;
+}
+
+// lower values are replaced first
+static int get_replacement_value(const uint64_t data) {
+    const int age = (int)((generation - get_generation(data)) & DATA_GENERATION_MASK);
+    return (int)get_depth(data) - (AGE_DEPTH_WEIGHT * age);
+}
+
+// Relaxed ordering is sufficient, since a mismatched pair of words is detected by the hash check
+static void load_entry(const struct tt_entry *const entry, uint64_t *position_hash, uint64_t *data) {
+    const uint64_t hash_xor_data = atomic_load_explicit(&entry->hash_xor_data, memory_order_relaxed);
+    *data = atomic_load_explicit(&entry->data, memory_order_relaxed);
+    *position_hash = hash_xor_data ^ *data;
 }
 
-static uint32_t get_index(const uint64_t hash) {
-    return (uint32_t)(hash % num_tt_elems);
+static void store_entry(struct tt_entry *const entry, const uint64_t position_hash, const uint64_t data) {
+    atomic_store_explicit(&entry->hash_xor_data, position_hash ^ data, memory_order_relaxed);
+    atomic_store_explicit(&entry->data, data, memory_order_relaxed);
 }
 
 #pragma GCC diagnostic push
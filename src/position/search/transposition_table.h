@@ -33,6 +33,9 @@
 #include "hashkeys.h"
 #include "move.h"
 
+// number of entries in each cache-line sized bucket
+#define TT_ENTRIES_PER_BUCKET 4
+
 enum node_type {
     NODE_EXACT, // exact evaluation of node
     NODE_ALPHA, // alpha cut-off
@@ -40,9 +43,13 @@ enum node_type {
 };
 
 void tt_create(uint64_t size_in_bytes);
+void tt_resize(uint64_t size_in_bytes);
 void tt_dispose(void);
+void tt_new_search(void);
 bool tt_add(const uint64_t position_hash, const struct move mv, const uint8_t depth, const int32_t score,
             const enum node_type node_type);
 bool tt_probe_position(const uint64_t position_hash, struct move *mv);
-uint32_t tt_capacity(void);
+uint64_t tt_capacity(void);
 size_t tt_entry_size(void);
+size_t tt_page_size(void);
+void tt_set_clear_threads(size_t num_threads);
@@ -0,0 +1,198 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+/*! @addtogroup Position
+ *
+ * @ingroup SEE
+ * @{
+ * @details Static Exchange Evaluation, estimates the material won or lost by the sequence of captures on a
+ * square, without making any moves.
+ *
+ */
+
+#include "see.h"
+#include "attack_checker.h"
+#include "bitboard.h"
+#include "board.h"
+#include "occupancy_mask.h"
+#include "square.h"
+#include <assert.h>
+#include <stdint.h>
+
+// attackers in the order they're used to recapture, least valuable first
+static const enum piece_role RECAPTURE_ORDER[] = {PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING};
+#define NUM_RECAPTURE_ROLES (sizeof(RECAPTURE_ORDER) / sizeof(RECAPTURE_ORDER[0]))
+
+static Score get_captured_value(const struct board *const brd, struct move mv);
+static Score get_moved_value(const struct board *const brd, struct move mv);
+
+/**
+ * @brief           Tests if the Static Exchange Evaluation of a move is at least the given threshold
+ * @details         Plays out the captures on the destination square, each side using its least valuable
+ *                  attacker, and allows either side to stop capturing when it would lose material. Sliders
+ *                  behind a capturing piece join in as they're revealed. Pins and checks are ignored.
+ *
+ * @param pos       The position
+ * @param mv        The move to evaluate
+ * @param threshold The minimum material gain, in centipawns
+ * @return true if the exchange gains at least 'threshold', false otherwise
+ */
+bool see_ge(const struct position *const pos, struct move mv, Score threshold) {
+    assert(validate_position(pos));
+    assert(validate_move(mv));
+
+    if (move_is_castle(mv)) {
+        return threshold <= 0;
+    }
+
+    const struct board *const brd = pos_get_board(pos);
+    const enum square from_sq = move_decode_from_sq(mv);
+    const enum square to_sq = move_decode_to_sq(mv);
+
+    // the gain if the opponent doesn't recapture
+    Score swap = get_captured_value(brd, mv) - threshold;
+    if (swap < 0) {
+        return false;
+    }
+
+    // the gain if the opponent recaptures and we can't reply
+    swap = get_moved_value(brd, mv) - swap;
+    if (swap <= 0) {
+        return true;
+    }
+
+    uint64_t occupied = brd_get_board_bb(brd) ^ SQUARE_AS_BITBOARD(from_sq) ^ SQUARE_AS_BITBOARD(to_sq);
+    if (move_is_en_passant(mv)) {
+        const enum square captured_sq = pos_get_side_to_move(pos) == WHITE ? sq_get_square_minus_1_rank(to_sq)
+                                                                             : sq_get_square_plus_1_rank(to_sq);
+        occupied ^= SQUARE_AS_BITBOARD(captured_sq);
+    }
+
+    const uint64_t bishop_queen_bb =
+        brd_get_bb_for_role_colour(brd, BISHOP, WHITE) | brd_get_bb_for_role_colour(brd, BISHOP, BLACK) |
+        brd_get_bb_for_role_colour(brd, QUEEN, WHITE) | brd_get_bb_for_role_colour(brd, QUEEN, BLACK);
+    const uint64_t rook_queen_bb =
+        brd_get_bb_for_role_colour(brd, ROOK, WHITE) | brd_get_bb_for_role_colour(brd, ROOK, BLACK) |
+        brd_get_bb_for_role_colour(brd, QUEEN, WHITE) | brd_get_bb_for_role_colour(brd, QUEEN, BLACK);
+
+    uint64_t attackers = att_chk_attackers_to(pos, to_sq, occupied);
+    enum colour side = pos_get_side_to_move(pos);
+
+    // true if the side that made the move comes out ahead, flipped for each capture
+    bool result = true;
+
+    while (true) {
+        side = pce_swap_side(side);
+        attackers &= occupied;
+
+        const uint64_t side_attackers = attackers & brd_get_colour_bb(brd, side);
+        if (side_attackers == 0) {
+            break;
+        }
+
+        result = !result;
+
+        enum piece_role role = KING;
+        uint64_t role_attackers = 0;
+        for (uint32_t i = 0; i < NUM_RECAPTURE_ROLES; i++) {
+            role = RECAPTURE_ORDER[i];
+            role_attackers = side_attackers & brd_get_bb_for_role_colour(brd, role, side);
+            if (role_attackers != 0) {
+                break;
+            }
+        }
+
+        if (role == KING) {
+            // the King can only recapture if the opponent has no attackers left
+            if ((attackers & ~brd_get_colour_bb(brd, side)) != 0) {
+                result = !result;
+            }
+            break;
+        }
+
+        swap = pce_get_value((enum piece)role) - swap;
+        if (swap < (Score)result) {
+            break;
+        }
+
+        // remove the attacker, and add any sliders behind it
+        occupied ^= SQUARE_AS_BITBOARD(bb_pop_1st_bit_and_clear(&role_attackers));
+        if (role == PAWN || role == BISHOP || role == QUEEN) {
+            attackers |= occ_mask_get_bishop_attacks(to_sq, occupied) & bishop_queen_bb;
+        }
+        if (role == ROOK || role == QUEEN) {
+            attackers |= occ_mask_get_rook_attacks(to_sq, occupied) & rook_queen_bb;
+        }
+    }
+
+    return result;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+
+static Score get_captured_value(const struct board *const brd, struct move mv) {
+    Score value = 0;
+
+    if (move_is_en_passant(mv)) {
+        value = pce_get_value(WHITE_PAWN);
+    } else {
+        enum piece victim;
+        if (brd_try_get_piece_on_square(brd, move_decode_to_sq(mv), &victim)) {
+            value = pce_get_value(victim);
+        }
+    }
+
+    // a promotion also gains the difference between the new piece and the pawn
+    if (move_is_promotion(mv)) {
+        value += get_moved_value(brd, mv) - pce_get_value(WHITE_PAWN);
+    }
+    return value;
+}
+
+static Score get_moved_value(const struct board *const brd, struct move mv) {
+    switch (move_get_move_type(mv)) {
+    case MV_TYPE_PROMOTE_KNIGHT:
+    case MV_TYPE_PROMOTE_KNIGHT_CAPTURE:
+        return pce_get_value(WHITE_KNIGHT);
+    case MV_TYPE_PROMOTE_BISHOP:
+    case MV_TYPE_PROMOTE_BISHOP_CAPTURE:
+        return pce_get_value(WHITE_BISHOP);
+    case MV_TYPE_PROMOTE_ROOK:
+    case MV_TYPE_PROMOTE_ROOK_CAPTURE:
+        return pce_get_value(WHITE_ROOK);
+    case MV_TYPE_PROMOTE_QUEEN:
+    case MV_TYPE_PROMOTE_QUEEN_CAPTURE:
+        return pce_get_value(WHITE_QUEEN);
+    default: {
+        enum piece pce;
+        brd_try_get_piece_on_square(brd, move_decode_from_sq(mv), &pce);
+        return pce_get_value(pce);
+    }
+    }
+}
+
+#pragma GCC diagnostic pop
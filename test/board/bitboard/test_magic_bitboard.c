@@ -0,0 +1,136 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include "test_magic_bitboard.h"
+#include "bitboard.h"
+#include "occupancy_mask.h"
+#include "rand.h"
+#include "square.h"
+#include <cmocka.h>
+
+#define NUM_RANDOM_OCCUPANCIES 2000
+
+static void compare_backend_against_reference(enum slider_attack_backend backend);
+static void assert_attacks_match_reference(void);
+static uint64_t get_reference_attacks(enum square sq, uint64_t occupied, const int deltas[4][2]);
+
+static const int ROOK_DELTAS[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+static const int BISHOP_DELTAS[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+void test_magic_bitboard_slider_attacks_match_reference(void **state) {
+    occ_mask_init_slider_attacks();
+
+    // on an empty board, every square sees 14 squares along the rank and file
+    for (enum square sq = a1; sq <= h8; sq++) {
+        assert_true(__builtin_popcountll(occ_mask_get_rook_attacks(sq, 0)) == 14);
+    }
+    // corners see the long diagonal, and the centre squares see 13 diagonal squares
+    assert_true(__builtin_popcountll(occ_mask_get_bishop_attacks(a1, 0)) == 7);
+    assert_true(__builtin_popcountll(occ_mask_get_bishop_attacks(d4, 0)) == 13);
+
+    // a full board only attacks the adjacent squares
+    assert_true(occ_mask_get_queen_attacks(d4, ~(uint64_t)0) == occ_mask_get_king(d4));
+
+    assert_attacks_match_reference();
+}
+
+void test_magic_bitboard_magic_backend_matches_reference(void **state) {
+    compare_backend_against_reference(SLIDER_BACKEND_MAGIC);
+}
+
+void test_magic_bitboard_pext_backend_matches_reference(void **state) {
+    if (!occ_mask_is_pext_supported()) {
+        // nothing to test on this host
+        return;
+    }
+    compare_backend_against_reference(SLIDER_BACKEND_PEXT);
+}
+
+void test_magic_bitboard_default_backend_is_fast_path(void **state) {
+    occ_mask_init_slider_attacks();
+
+    // PEXT is only preferred when it's implemented in hardware
+    if (occ_mask_is_pext_fast()) {
+        assert_true(occ_mask_is_pext_supported());
+        assert_true(occ_mask_get_slider_backend() == SLIDER_BACKEND_PEXT);
+    } else {
+        assert_true(occ_mask_get_slider_backend() == SLIDER_BACKEND_MAGIC);
+    }
+}
+
+static void compare_backend_against_reference(enum slider_attack_backend backend) {
+    occ_mask_init_slider_attacks();
+    const enum slider_attack_backend orig_backend = occ_mask_get_slider_backend();
+
+    assert_true(occ_mask_set_slider_backend(backend));
+    assert_true(occ_mask_get_slider_backend() == backend);
+
+    assert_attacks_match_reference();
+
+    occ_mask_set_slider_backend(orig_backend);
+}
+
+static void assert_attacks_match_reference(void) {
+    init_prng();
+    for (int i = 0; i < NUM_RANDOM_OCCUPANCIES; i++) {
+        // sparse and dense boards
+        const uint64_t occupied = (i & 1) ? genrand64_int64() & genrand64_int64() : genrand64_int64();
+
+        for (enum square sq = a1; sq <= h8; sq++) {
+            const uint64_t rook_attacks = get_reference_attacks(sq, occupied, ROOK_DELTAS);
+            const uint64_t bishop_attacks = get_reference_attacks(sq, occupied, BISHOP_DELTAS);
+
+            assert_true(occ_mask_get_rook_attacks(sq, occupied) == rook_attacks);
+            assert_true(occ_mask_get_bishop_attacks(sq, occupied) == bishop_attacks);
+            assert_true(occ_mask_get_queen_attacks(sq, occupied) == (rook_attacks | bishop_attacks));
+        }
+    }
+}
+
+// walk each ray until it goes off the board or hits an occupied square
+static uint64_t get_reference_attacks(enum square sq, uint64_t occupied, const int deltas[4][2]) {
+    uint64_t attacks = 0;
+    const enum rank sq_rank = sq_get_rank(sq);
+    const enum file sq_file = sq_get_file(sq);
+
+    for (int d = 0; d < 4; d++) {
+        int rank = (int)sq_rank + deltas[d][0];
+        int file = (int)sq_file + deltas[d][1];
+
+        while (rank >= 0 && rank < 8 && file >= 0 && file < 8) {
+            const uint64_t bb = SQUARE_AS_BITBOARD(sq_gen_from_rank_file((enum rank)rank, (enum file)file));
+            attacks |= bb;
+            if ((occupied & bb) != 0) {
+                break;
+            }
+            rank += deltas[d][0];
+            file += deltas[d][1];
+        }
+    }
+    return attacks;
+}
@@ -266,3 +266,18 @@ void test_move_double_pawn_move_encode_decode(void **state) {
     assert_false(move_is_promotion(mv));
     assert_false(move_is_queen_castle(mv));
 }
+
+void test_move_packed_into_16_bits(void **state) {
+    assert_true(sizeof(struct move) == sizeof(uint16_t));
+
+    // all squares and move types survive the round trip
+    for (enum square from_sq = a1; from_sq <= h8; from_sq++) {
+        const enum square to_sq = (enum square)(h8 - from_sq);
+
+        const struct move mv = move_encode_promote_queen_with_capture(from_sq, to_sq);
+
+        assert_true(move_decode_from_sq(mv) == from_sq);
+        assert_true(move_decode_to_sq(mv) == to_sq);
+        assert_true(move_get_move_type(mv) == MV_TYPE_PROMOTE_QUEEN_CAPTURE);
+    }
+}
@@ -1163,3 +1163,211 @@ void test_move_black_capture_only_moves(void **state) {
     contains_promote(&mvl, g2, f1, BLACK_BISHOP, true);
     contains_promote(&mvl, g2, f1, BLACK_KNIGHT, true);
 }
+
+void test_move_legal_moves_pinned_piece(void **state) {
+    // White Knight on e2 is pinned by the Rook on e8, Bishop on d2 is pinned by the Bishop on a5
+    const char *FEN = "4r1k1/8/8/b7/8/8/3BN3/4K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_legal_moves(pos, &mvl);
+
+    // King : d1, f1, f2 (d2 and e2 occupied)
+    // Bishop d2 : c3, b4, xa5
+    assert_true(mvl.move_count == 6);
+
+    CONTAINS_QUIET(mvl, e1, d1);
+    CONTAINS_QUIET(mvl, e1, f1);
+    CONTAINS_QUIET(mvl, e1, f2);
+    CONTAINS_QUIET(mvl, d2, c3);
+    CONTAINS_QUIET(mvl, d2, b4);
+    CONTAINS_CAPTURE(mvl, d2, a5);
+}
+
+void test_move_legal_moves_en_passant_discovered_check(void **state) {
+    // capturing en passant would remove both pawns from the 5th rank, exposing the King to the Rook
+    const char *FEN = "8/8/8/K2pP2r/8/8/8/7k w - d6 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_legal_moves(pos, &mvl);
+
+    const struct move en_pass = move_encode_enpassant(e5, d6);
+    assert_false(mvl_contains_move(&mvl, en_pass));
+
+    // King : a4, a6, b4, b5, b6; Pawn : e6
+    assert_true(mvl.move_count == 6);
+}
+
+void test_move_legal_moves_en_passant_evades_check(void **state) {
+    // the double-moved pawn on d5 gives check; capturing it en passant is legal
+    const char *FEN = "8/8/8/3pP3/4K3/8/8/7k w - d6 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_legal_moves(pos, &mvl);
+
+    const struct move en_pass = move_encode_enpassant(e5, d6);
+    assert_true(mvl_contains_move(&mvl, en_pass));
+
+    // pawn e6 doesn't resolve the check
+    const struct move quiet = move_encode_quiet(e5, e6);
+    assert_false(mvl_contains_move(&mvl, quiet));
+}
+
+void test_move_legal_moves_castle_through_attack(void **state) {
+    // f1 is attacked by the Rook on f8, so King-side castling is illegal. Queen-side is legal as
+    // only b1 (which the King doesn't cross) is attacked
+    const char *FEN = "1r3rk1/8/8/8/8/8/8/R3K2R w KQ - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_legal_moves(pos, &mvl);
+
+    assert_false(mvl_contains_move(&mvl, move_encode_castle_kingside_white()));
+    assert_true(mvl_contains_move(&mvl, move_encode_castle_queenside_white()));
+}
+
+void test_move_legal_moves_double_check(void **state) {
+    // King in check from the Knight on f3 and the Rook on e8, only King moves are legal
+    const char *FEN = "4r1k1/8/8/8/8/5n2/3Q4/4K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_legal_moves(pos, &mvl);
+
+    // King : d1, f1, f2 (e2 attacked by the Rook, d2 occupied)
+    assert_true(mvl.move_count == 3);
+
+    CONTAINS_QUIET(mvl, e1, d1);
+    CONTAINS_QUIET(mvl, e1, f1);
+    CONTAINS_QUIET(mvl, e1, f2);
+}
+
+void test_move_gen_evasions_single_check(void **state) {
+    // King in check from the Rook on e8, only King moves, capturing the Rook or blocking on the e-file
+    const char *FEN = "4r1k1/8/8/1B6/R7/2N5/8/4K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_evasion_moves(pos, &mvl);
+
+    assert_true(mvl.move_count == 9);
+
+    // King : d1, d2, f1, f2 (e2 is attacked by the Rook)
+    CONTAINS_QUIET(mvl, e1, d1);
+    CONTAINS_QUIET(mvl, e1, d2);
+    CONTAINS_QUIET(mvl, e1, f1);
+    CONTAINS_QUIET(mvl, e1, f2);
+    // Knight blocks
+    CONTAINS_QUIET(mvl, c3, e2);
+    CONTAINS_QUIET(mvl, c3, e4);
+    // Bishop blocks or captures the checker
+    CONTAINS_QUIET(mvl, b5, e2);
+    CONTAINS_CAPTURE(mvl, b5, e8);
+    // Rook blocks
+    CONTAINS_QUIET(mvl, a4, e4);
+}
+
+void test_move_gen_evasions_en_passant_captures_checker(void **state) {
+    // the double-moved pawn on d5 gives check, and can be captured en passant
+    const char *FEN = "8/8/8/3pP3/4K3/8/8/7k w - d6 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_evasion_moves(pos, &mvl);
+
+    // King : d3, e3, f3, d4, f4, f5, xd5 and the en passant capture
+    assert_true(mvl.move_count == 8);
+
+    CONTAINS_CAPTURE(mvl, e4, d5);
+    const struct move en_pass = move_encode_enpassant(e5, d6);
+    assert_true(mvl_contains_move(&mvl, en_pass));
+
+    // pawn e6 doesn't resolve the check
+    const struct move quiet = move_encode_quiet(e5, e6);
+    assert_false(mvl_contains_move(&mvl, quiet));
+}
+
+void test_move_gen_quiet_checks_direct(void **state) {
+    const char *FEN = "4k3/8/5P2/8/4N3/8/8/R3K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_quiet_check_moves(pos, &mvl);
+
+    assert_true(mvl.move_count == 3);
+
+    CONTAINS_QUIET(mvl, a1, a8);
+    CONTAINS_QUIET(mvl, e4, d6);
+    CONTAINS_QUIET(mvl, f6, f7);
+}
+
+void test_move_gen_quiet_checks_discovered(void **state) {
+    // the Knight blocks the Rook on the e-file, the pawn blocks the Bishop on the a4-e8 diagonal
+    const char *FEN = "4k3/8/2P5/8/B3N3/8/8/K3R3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct move_list mvl = mvl_initialise();
+
+    mv_gen_quiet_check_moves(pos, &mvl);
+
+    // all 8 Knight moves, and the pawn push
+    assert_true(mvl.move_count == 9);
+
+    CONTAINS_QUIET(mvl, e4, d6);
+    CONTAINS_QUIET(mvl, e4, f6);
+    CONTAINS_QUIET(mvl, e4, c5);
+    CONTAINS_QUIET(mvl, e4, c3);
+    CONTAINS_QUIET(mvl, e4, d2);
+    CONTAINS_QUIET(mvl, e4, f2);
+    CONTAINS_QUIET(mvl, e4, g3);
+    CONTAINS_QUIET(mvl, e4, g5);
+    CONTAINS_QUIET(mvl, c6, c7);
+}
+
+void test_move_count_legal_moves_matches_generator(void **state) {
+    const char *FENS[] = {
+        // start position
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1\n",
+        // castling, pins, promotions
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1\n",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1\n",
+        "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1\n",
+        // en passant, including the rank-pin case
+        "8/8/8/3pP3/4K3/8/8/7k w - d6 0 1\n",
+        "8/8/8/K2pP2r/8/8/8/7k w - d6 0 1\n",
+        // single and double check
+        "4r1k1/8/8/1B6/R7/2N5/8/4K3 w - - 0 1\n",
+        "4r1k1/8/8/8/8/5n2/3Q4/4K3 w - - 0 1\n",
+    };
+
+    for (size_t i = 0; i < sizeof(FENS) / sizeof(FENS[0]); i++) {
+        struct position *pos = pos_create();
+        pos_initialise(FENS[i], pos);
+        struct move_list mvl = mvl_initialise();
+
+        mv_gen_legal_moves(pos, &mvl);
+
+        assert_true(mv_gen_count_legal_moves(pos) == mvl.move_count);
+
+        pos_destroy(pos);
+    }
+}
@@ -89,3 +89,13 @@ void test_move_all_moves_4_knights_opening_white_to_move(void **state);
 
 void test_move_white_capture_only_moves(void **state);
 void test_move_black_capture_only_moves(void **state);
+void test_move_legal_moves_pinned_piece(void **state);
+void test_move_legal_moves_en_passant_discovered_check(void **state);
+void test_move_legal_moves_en_passant_evades_check(void **state);
+void test_move_legal_moves_castle_through_attack(void **state);
+void test_move_legal_moves_double_check(void **state);
+void test_move_gen_evasions_single_check(void **state);
+void test_move_gen_evasions_en_passant_captures_checker(void **state);
+void test_move_gen_quiet_checks_direct(void **state);
+void test_move_gen_quiet_checks_discovered(void **state);
+void test_move_count_legal_moves_matches_generator(void **state);
@@ -0,0 +1,220 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#include "test_move_picker.h"
+#include "move.h"
+#include "move_gen.h"
+#include "move_list.h"
+#include "move_picker.h"
+#include "position.h"
+#include <cmocka.h>
+
+void test_move_picker_returns_all_moves(void **state) {
+    const char *FEN = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    struct move_list all_moves = mvl_initialise();
+    mv_gen_all_moves(pos, &all_moves);
+
+    const struct move tt_move = move_encode_capture(e2, a6);
+    const struct move killers[MOVE_PICKER_NUM_KILLERS] = {move_encode_quiet(a2, a3), move_encode_quiet(g2, g3)};
+
+    struct move_picker mp;
+    mv_pick_init(&mp, pos, tt_move, killers);
+
+    struct move_list picked = mvl_initialise();
+    struct move mv;
+    while (mv_pick_next(&mp, &mv)) {
+        // no duplicates
+        assert_false(mvl_contains_move(&picked, mv));
+        mvl_add(&picked, mv);
+    }
+
+    assert_true(mvl_get_move_count(&picked) == mvl_get_move_count(&all_moves));
+    for (uint16_t i = 0; i < mvl_get_move_count(&all_moves); i++) {
+        assert_true(mvl_contains_move(&picked, mvl_get_move_at_offset(&all_moves, i)));
+    }
+    assert_true(mv_pick_get_stage(&mp) == MP_STAGE_DONE);
+
+    pos_destroy(pos);
+}
+
+void test_move_picker_stage_order(void **state) {
+    // exd6 is a good capture, Qxd6 is a bad capture as the Knight is defended by the pawn on c7
+    const char *FEN = "4k3/2p5/3n4/4P3/8/8/8/3QK3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    const struct move tt_move = move_encode_quiet(e1, f1);
+    const struct move killers[MOVE_PICKER_NUM_KILLERS] = {move_encode_quiet(d1, a4), move_get_no_move()};
+
+    struct move_picker mp;
+    mv_pick_init(&mp, pos, tt_move, killers);
+
+    struct move mv;
+    assert_true(mv_pick_next(&mp, &mv));
+    assert_true(move_compare(mv, tt_move));
+
+    assert_true(mv_pick_next(&mp, &mv));
+    assert_true(move_compare(mv, move_encode_capture(e5, d6)));
+
+    assert_true(mv_pick_next(&mp, &mv));
+    assert_true(move_compare(mv, killers[0]));
+
+    struct move last_mv = mv;
+    while (mv_pick_next(&mp, &mv)) {
+        assert_false(move_compare(mv, tt_move));
+        assert_false(move_compare(mv, killers[0]));
+        last_mv = mv;
+    }
+    assert_true(move_compare(last_mv, move_encode_capture(d1, d6)));
+
+    pos_destroy(pos);
+}
+
+void test_move_picker_invalid_tt_and_killer_moves_skipped(void **state) {
+    const char *FEN = "4k3/8/3n4/4P3/8/8/8/3QK3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    // no piece on a2, and the Queen can't move like a Knight
+    const struct move tt_move = move_encode_quiet(a2, a3);
+    const struct move killers[MOVE_PICKER_NUM_KILLERS] = {move_encode_quiet(d1, e3), move_get_no_move()};
+
+    struct move_picker mp;
+    mv_pick_init(&mp, pos, tt_move, killers);
+
+    struct move_list picked = mvl_initialise();
+    struct move mv;
+    while (mv_pick_next(&mp, &mv)) {
+        mvl_add(&picked, mv);
+    }
+
+    assert_false(mvl_contains_move(&picked, tt_move));
+    assert_false(mvl_contains_move(&picked, killers[0]));
+
+    // first move is the good capture
+    assert_true(move_compare(mvl_get_move_at_offset(&picked, 0), move_encode_capture(e5, d6)));
+
+    pos_destroy(pos);
+}
+
+void test_move_picker_malformed_double_push_skipped(void **state) {
+    struct position *pos = pos_create();
+    pos_initialise(INITIAL_FEN, pos);
+
+    // single pushes encoded as double pushes, eg from a TT hash collision
+    const struct move tt_move = move_encode_pawn_double_first(e2, e3);
+    const struct move killers[MOVE_PICKER_NUM_KILLERS] = {move_encode_pawn_double_first(d2, d3),
+                                                          move_get_no_move()};
+
+    struct move_picker mp;
+    mv_pick_init(&mp, pos, tt_move, killers);
+
+    struct move_list picked = mvl_initialise();
+    struct move mv;
+    while (mv_pick_next(&mp, &mv)) {
+        mvl_add(&picked, mv);
+    }
+
+    assert_false(mvl_contains_move(&picked, tt_move));
+    assert_false(mvl_contains_move(&picked, killers[0]));
+    // the properly encoded pushes are still returned
+    assert_true(mvl_contains_move(&picked, move_encode_quiet(e2, e3)));
+    assert_true(mvl_contains_move(&picked, move_encode_pawn_double_first(e2, e4)));
+    assert_true(mvl_get_move_count(&picked) == 20);
+
+    pos_destroy(pos);
+}
+
+void test_move_picker_tt_move_does_not_generate_moves(void **state) {
+    struct position *pos = pos_create();
+    pos_initialise(INITIAL_FEN, pos);
+
+    const struct move tt_move = move_encode_pawn_double_first(e2, e4);
+
+    struct move_picker mp;
+    mv_pick_init(&mp, pos, tt_move, NULL);
+
+    struct move mv;
+    assert_true(mv_pick_next(&mp, &mv));
+    assert_true(move_compare(mv, tt_move));
+
+    // nothing generated yet
+    assert_true(mv_pick_get_stage(&mp) == MP_STAGE_GEN_CAPTURES);
+    assert_true(mvl_get_move_count(&mp.mvl) == 0);
+
+    pos_destroy(pos);
+}
+
+void test_move_picker_in_check_only_returns_evasions(void **state) {
+    // White King in check from the Rook on e8. The Bishop, Knight and Queen can interpose,
+    // and the King can step aside
+    const char *FEN = "k3r3/8/8/8/8/5B2/3N4/3QK3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    assert_true(pos_is_in_check(pos));
+
+    struct move_list evasions = mvl_initialise();
+    mv_gen_evasion_moves(pos, &evasions);
+
+    struct move_list all_moves = mvl_initialise();
+    mv_gen_all_moves(pos, &all_moves);
+    assert_true(mvl_get_move_count(&evasions) < mvl_get_move_count(&all_moves));
+
+    // the TT move is still returned first
+    const struct move tt_move = move_encode_quiet(f3, e4);
+    const struct move killers[MOVE_PICKER_NUM_KILLERS] = {move_encode_quiet(d1, a4), move_get_no_move()};
+
+    struct move_picker mp;
+    mv_pick_init(&mp, pos, tt_move, killers);
+
+    struct move_list picked = mvl_initialise();
+    struct move mv;
+    assert_true(mv_pick_next(&mp, &mv));
+    assert_true(move_compare(mv, tt_move));
+    assert_true(mv_pick_get_stage(&mp) == MP_STAGE_GEN_EVASIONS);
+    mvl_add(&picked, mv);
+
+    while (mv_pick_next(&mp, &mv)) {
+        assert_false(mvl_contains_move(&picked, mv));
+        assert_true(mvl_contains_move(&evasions, mv));
+        mvl_add(&picked, mv);
+    }
+
+    // every evasion, and nothing else
+    assert_true(mvl_get_move_count(&picked) == mvl_get_move_count(&evasions));
+    assert_false(mvl_contains_move(&picked, killers[0]));
+    assert_true(mv_pick_get_stage(&mp) == MP_STAGE_DONE);
+
+    pos_destroy(pos);
+}
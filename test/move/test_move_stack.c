@@ -0,0 +1,84 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#include "test_move_stack.h"
+#include "move.h"
+#include "move_list.h"
+#include "move_stack.h"
+#include <cmocka.h>
+
+void test_move_stack_push_pop(void **state) {
+    struct move_stack *mvs = mvs_create();
+    assert_true(mvs_get_depth(mvs) == 0);
+
+    mvs_push(mvs);
+    mvs_push(mvs);
+    assert_true(mvs_get_depth(mvs) == 2);
+
+    mvs_pop(mvs);
+    assert_true(mvs_get_depth(mvs) == 1);
+
+    mvs_pop(mvs);
+    assert_true(mvs_get_depth(mvs) == 0);
+
+    mvs_destroy(mvs);
+}
+
+void test_move_stack_pushed_list_is_empty(void **state) {
+    struct move_stack *mvs = mvs_create();
+
+    struct move_list *mvl = mvs_push(mvs);
+    mvl_add(mvl, move_encode_quiet(a2, a3));
+    mvl_add(mvl, move_encode_quiet(b2, b3));
+    mvs_pop(mvs);
+
+    // the same slot is reused, and is reset
+    mvl = mvs_push(mvs);
+    assert_true(mvl_get_move_count(mvl) == 0);
+
+    mvs_destroy(mvs);
+}
+
+void test_move_stack_lists_are_independent(void **state) {
+    struct move_stack *mvs = mvs_create();
+
+    struct move_list *parent = mvs_push(mvs);
+    const struct move parent_mv = move_encode_quiet(a2, a3);
+    mvl_add(parent, parent_mv);
+
+    struct move_list *child = mvs_push(mvs);
+    assert_true(child != parent);
+    mvl_add(child, move_encode_quiet(h7, h6));
+    mvl_add(child, move_encode_quiet(g7, g6));
+    mvs_pop(mvs);
+
+    assert_true(mvl_get_move_count(parent) == 1);
+    assert_true(move_compare(mvl_get_move_at_offset(parent, 0), parent_mv));
+
+    mvs_pop(mvs);
+    mvs_destroy(mvs);
+}
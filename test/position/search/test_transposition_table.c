@@ -28,9 +28,12 @@
 
 #include "test_transposition_table.h"
 #include "rand.h"
+#include "search.h"
 #include "transposition_table.h"
 
 #include <cmocka.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdint.h>
 
 #define MILLION 1000000
@@ -63,10 +66,16 @@ void test_transposition_table_add_multiple_all_present(void **state) {
 
     tt_create((TABLE_SIZE * tt_entry_size()));
 
+    // the bucket is selected using the high bits of the hash, so use random hashes
+    static uint64_t hashes[NUM_TO_ADD];
+    init_prng();
+    for (uint64_t i = 0; i < NUM_TO_ADD; i++) {
+        hashes[i] = genrand64_int64();
+    }
+
     // populate tt with test entries
     for (uint64_t i = 0; i < NUM_TO_ADD; i++) {
-        uint64_t hash = i;
-        const bool added = tt_add(hash, mv, depth, score, nt);
+        const bool added = tt_add(hashes[i], mv, depth, score, nt);
         assert_true(added);
     }
 
@@ -74,11 +83,249 @@ void test_transposition_table_add_multiple_all_present(void **state) {
     for (uint64_t i = 0; i < NUM_TO_ADD; i++) {
         struct move found_mv;
 
-        uint64_t h = i;
-
-        const bool found = tt_probe_position(h, &found_mv);
+        const bool found = tt_probe_position(hashes[i], &found_mv);
         assert_true(found);
     }
 
     tt_dispose();
 }
+
+// returns a hash that maps to the first bucket in the table, ie any hash below 2^64 / num buckets
+static uint64_t get_hash_for_first_bucket(uint64_t n) {
+    return n + 1;
+}
+
+void test_transposition_table_full_bucket_replaces_shallowest_entry(void **state) {
+    const struct move mv = move_encode_quiet(a1, b2);
+    const uint8_t depths[TT_ENTRIES_PER_BUCKET] = {5, 2, 7, 4};
+
+    tt_create(2 * MILLION * tt_entry_size());
+
+    for (uint64_t i = 0; i < TT_ENTRIES_PER_BUCKET; i++) {
+        assert_true(tt_add(get_hash_for_first_bucket(i), mv, depths[i], 100, NODE_EXACT));
+    }
+
+    // bucket is full, so the depth 2 entry is replaced
+    assert_true(tt_add(get_hash_for_first_bucket(TT_ENTRIES_PER_BUCKET), mv, 3, 100, NODE_EXACT));
+
+    for (uint64_t i = 0; i <= TT_ENTRIES_PER_BUCKET; i++) {
+        struct move found_mv;
+        const bool found = tt_probe_position(get_hash_for_first_bucket(i), &found_mv);
+        assert_true(found == (i != 1));
+    }
+
+    tt_dispose();
+}
+
+void test_transposition_table_same_position_replaced_by_depth_and_age(void **state) {
+    const struct move mv1 = move_encode_quiet(a1, b2);
+    const struct move mv2 = move_encode_quiet(c3, d4);
+    const uint64_t hash = get_hash_for_first_bucket(0);
+    struct move found_mv;
+
+    tt_create(2 * MILLION * tt_entry_size());
+
+    assert_true(tt_add(hash, mv1, 6, 100, NODE_EXACT));
+
+    // shallower search of the same position in the same search is ignored
+    assert_false(tt_add(hash, mv2, 4, 100, NODE_ALPHA));
+    assert_true(tt_probe_position(hash, &found_mv));
+    assert_true(move_compare(found_mv, mv1));
+
+    // ...but replaces the entry once it's from an earlier search
+    tt_new_search();
+    assert_true(tt_add(hash, mv2, 4, 100, NODE_ALPHA));
+    assert_true(tt_probe_position(hash, &found_mv));
+    assert_true(move_compare(found_mv, mv2));
+
+    tt_dispose();
+}
+
+void test_transposition_table_old_entries_replaced_before_deeper_new_entries(void **state) {
+    const struct move mv = move_encode_quiet(a1, b2);
+
+    tt_create(2 * MILLION * tt_entry_size());
+
+    // deep entries from an old search
+    assert_true(tt_add(get_hash_for_first_bucket(0), mv, 10, 100, NODE_EXACT));
+    assert_true(tt_add(get_hash_for_first_bucket(1), mv, 10, 100, NODE_EXACT));
+
+    tt_new_search();
+    tt_new_search();
+    tt_new_search();
+
+    // shallower entries from the current search
+    assert_true(tt_add(get_hash_for_first_bucket(2), mv, 6, 100, NODE_EXACT));
+    assert_true(tt_add(get_hash_for_first_bucket(3), mv, 6, 100, NODE_EXACT));
+
+    // bucket is full, an old entry is replaced
+    assert_true(tt_add(get_hash_for_first_bucket(4), mv, 1, 100, NODE_EXACT));
+
+    struct move found_mv;
+    assert_false(tt_probe_position(get_hash_for_first_bucket(0), &found_mv));
+    assert_true(tt_probe_position(get_hash_for_first_bucket(1), &found_mv));
+    assert_true(tt_probe_position(get_hash_for_first_bucket(2), &found_mv));
+    assert_true(tt_probe_position(get_hash_for_first_bucket(3), &found_mv));
+    assert_true(tt_probe_position(get_hash_for_first_bucket(4), &found_mv));
+
+    tt_dispose();
+}
+
+void test_transposition_table_capacity_matches_size(void **state) {
+    const uint64_t bucket_size = TT_ENTRIES_PER_BUCKET * tt_entry_size();
+
+    // not a power of two
+    tt_create(30001 * bucket_size);
+    assert_int_equal(tt_capacity(), 30001 * TT_ENTRIES_PER_BUCKET);
+    tt_dispose();
+
+    // too small, so the minimum size is used
+    tt_create(bucket_size);
+    assert_true(tt_capacity() > TT_ENTRIES_PER_BUCKET);
+    tt_dispose();
+}
+
+void test_transposition_table_resize_clears_table(void **state) {
+    const struct move mv = move_encode_quiet(a1, b2);
+    const uint64_t bucket_size = TT_ENTRIES_PER_BUCKET * tt_entry_size();
+    const uint64_t hash = 0x0123456789abcdefULL;
+    struct move found_mv;
+
+    tt_create(40000 * bucket_size);
+    assert_true(tt_add(hash, mv, 5, 100, NODE_EXACT));
+
+    // shrink, reusing the allocation
+    tt_resize(30000 * bucket_size);
+    assert_int_equal(tt_capacity(), 30000 * TT_ENTRIES_PER_BUCKET);
+    assert_false(tt_probe_position(hash, &found_mv));
+    assert_true(tt_add(hash, mv, 5, 100, NODE_EXACT));
+    assert_true(tt_probe_position(hash, &found_mv));
+
+    // grow
+    tt_resize(50000 * bucket_size);
+    assert_int_equal(tt_capacity(), 50000 * TT_ENTRIES_PER_BUCKET);
+    assert_false(tt_probe_position(hash, &found_mv));
+    assert_true(tt_add(hash, mv, 5, 100, NODE_EXACT));
+    assert_true(tt_probe_position(hash, &found_mv));
+
+    tt_dispose();
+}
+
+#define STRESS_NUM_THREADS 8
+#define STRESS_NUM_ITERATIONS 200000
+#define STRESS_NUM_POSITIONS 64
+
+struct stress_thread_data {
+    uint64_t seed;
+    _Atomic uint64_t *num_probe_hits;
+    _Atomic uint64_t *num_bad_probes;
+};
+
+// each position has its own move, so a probe can tell if it was given another position's data
+static struct move get_stress_move(uint64_t position) {
+    return move_encode_quiet((enum square)position, (enum square)((position + 1) % STRESS_NUM_POSITIONS));
+}
+
+static void *stress_thread(void *arg) {
+    struct stress_thread_data *data = (struct stress_thread_data *)arg;
+    uint64_t rnd = data->seed;
+    uint64_t hits = 0;
+    uint64_t bad = 0;
+
+    for (uint32_t i = 0; i < STRESS_NUM_ITERATIONS; i++) {
+        // xorshift
+        rnd ^= rnd << 13;
+        rnd ^= rnd >> 7;
+        rnd ^= rnd << 17;
+
+        // small hashes all map to the first bucket, so the threads are continually overwriting each other
+        const uint64_t position = rnd % STRESS_NUM_POSITIONS;
+        const uint64_t hash = position + 1;
+
+        tt_add(hash, get_stress_move(position), (uint8_t)(i % MAX_SEARCH_DEPTH), (int32_t)i, NODE_EXACT);
+
+        struct move found_mv;
+        if (tt_probe_position(hash, &found_mv)) {
+            hits++;
+            if (!move_compare(found_mv, get_stress_move(position))) {
+                bad++;
+            }
+        }
+    }
+
+    atomic_fetch_add(data->num_probe_hits, hits);
+    atomic_fetch_add(data->num_bad_probes, bad);
+    return NULL;
+}
+
+void test_transposition_table_concurrent_access_no_torn_entries(void **state) {
+    pthread_t threads[STRESS_NUM_THREADS];
+    struct stress_thread_data thread_data[STRESS_NUM_THREADS];
+    _Atomic uint64_t num_probe_hits = 0;
+    _Atomic uint64_t num_bad_probes = 0;
+
+    tt_create(2 * MILLION * tt_entry_size());
+
+    for (int i = 0; i < STRESS_NUM_THREADS; i++) {
+        thread_data[i].seed = (uint64_t)0x9E3779B97F4A7C15 * (uint64_t)(i + 1);
+        thread_data[i].num_probe_hits = &num_probe_hits;
+        thread_data[i].num_bad_probes = &num_bad_probes;
+        assert_int_equal(pthread_create(&threads[i], NULL, stress_thread, &thread_data[i]), 0);
+    }
+    for (int i = 0; i < STRESS_NUM_THREADS; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+
+    const uint64_t hits = atomic_load(&num_probe_hits);
+    const uint64_t bad = atomic_load(&num_bad_probes);
+    assert_true(hits > 0);
+    assert_true(bad == 0);
+
+    tt_dispose();
+}
+
+void test_transposition_table_page_size_reported(void **state) {
+    tt_create(64 * MB);
+
+    // either normal or huge pages, but always a power of two
+    const size_t page_size = tt_page_size();
+    assert_true(page_size >= 4096);
+    assert_true((page_size & (page_size - 1)) == 0);
+
+    tt_dispose();
+    assert_true(tt_page_size() == 0);
+}
+
+void test_transposition_table_cleared_across_threads(void **state) {
+#define NUM_CLEAR_THREAD_COUNTS 4
+    // odd thread counts leave a remainder for the last thread
+    const size_t thread_counts[NUM_CLEAR_THREAD_COUNTS] = {2, 3, 7, 64};
+    const struct move mv = move_encode_quiet(a1, b2);
+
+    for (int t = 0; t < NUM_CLEAR_THREAD_COUNTS; t++) {
+        tt_set_clear_threads(thread_counts[t]);
+        // small, with a bucket count that doesn't divide evenly between the threads
+        tt_create(MB + 3 * 64);
+
+        const uint64_t num_buckets = tt_capacity() / TT_ENTRIES_PER_BUCKET;
+        // the bucket is the high 64 bits of hash * num_buckets, so multiples of this step land in every bucket
+        const uint64_t bucket_step = UINT64_MAX / num_buckets + 1;
+
+        for (uint64_t b = 0; b < num_buckets; b++) {
+            assert_true(tt_add(b * bucket_step + 1, mv, 5, 100, NODE_EXACT));
+        }
+        struct move found_mv;
+        assert_true(tt_probe_position(1, &found_mv));
+        assert_true(tt_probe_position((num_buckets - 1) * bucket_step + 1, &found_mv));
+
+        tt_resize(MB + 3 * 64);
+
+        for (uint64_t b = 0; b < num_buckets; b++) {
+            assert_false(tt_probe_position(b * bucket_step + 1, &found_mv));
+        }
+
+        tt_dispose();
+    }
+
+    tt_set_clear_threads(0);
+}
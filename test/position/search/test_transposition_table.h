@@ -29,3 +29,11 @@
 
 void test_transposition_table_create_different_sizes_as_expected(void **state);
 void test_transposition_table_add_multiple_all_present(void **state);
+void test_transposition_table_full_bucket_replaces_shallowest_entry(void **state);
+void test_transposition_table_same_position_replaced_by_depth_and_age(void **state);
+void test_transposition_table_old_entries_replaced_before_deeper_new_entries(void **state);
+void test_transposition_table_capacity_matches_size(void **state);
+void test_transposition_table_resize_clears_table(void **state);
+void test_transposition_table_concurrent_access_no_torn_entries(void **state);
+void test_transposition_table_page_size_reported(void **state);
+void test_transposition_table_cleared_across_threads(void **state);
@@ -28,6 +28,10 @@
 
 #include "test_attack_checker.h"
 #include "attack_checker.h"
+#include "bitboard.h"
+#include "board.h"
+#include "move.h"
+#include "occupancy_mask.h"
 #include "position.h"
 #include <cmocka.h>
 #include <stdint.h>
@@ -181,3 +185,58 @@ void test_att_chk_is_black_diagonal_attacking(void **state) {
         assert_false(att_chk_is_sq_attacked(pos, not_attacked_sq[i], BLACK));
     }
 }
+
+void test_att_chk_attackers_to(void **state) {
+    // d4 is attacked by pawns, Knights and the Rook of both sides. The Queen on a7 and the Bishop on g1
+    // are behind the pawns
+    const char *fen = "4k3/q7/8/2p2n2/8/1N2P3/8/3RK1B1 w - - 0 1";
+
+    struct position *pos = pos_create();
+    pos_initialise(fen, pos);
+
+    const struct board *brd = pos_get_board(pos);
+    const uint64_t direct_bb = SQUARE_AS_BITBOARD(c5) | SQUARE_AS_BITBOARD(e3) | SQUARE_AS_BITBOARD(b3) |
+                               SQUARE_AS_BITBOARD(f5) | SQUARE_AS_BITBOARD(d1);
+
+    assert_true(att_chk_attackers_to(pos, d4, brd_get_board_bb(brd)) == direct_bb);
+
+    // remove the pawns from the occupancy, to reveal the sliders behind them
+    const uint64_t occupied = brd_get_board_bb(brd) & ~(SQUARE_AS_BITBOARD(c5) | SQUARE_AS_BITBOARD(e3));
+    const uint64_t x_ray_bb = direct_bb | SQUARE_AS_BITBOARD(a7) | SQUARE_AS_BITBOARD(g1);
+
+    assert_true(att_chk_attackers_to(pos, d4, occupied) == x_ray_bb);
+
+    pos_destroy(pos);
+}
+
+void test_att_chk_attack_map(void **state) {
+    const char *fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+    struct position *pos = pos_create();
+    pos_initialise(fen, pos);
+
+    struct attack_map map;
+    att_chk_build_attack_map(pos, &map);
+
+    for (enum square sq = a1; sq <= h8; sq++) {
+        assert_true(bb_is_set(map.by_colour[WHITE], sq) == att_chk_is_sq_attacked(pos, sq, WHITE));
+        assert_true(bb_is_set(map.by_colour[BLACK], sq) == att_chk_is_sq_attacked(pos, sq, BLACK));
+    }
+
+    // the Knights on c3/e5 and the pawns on b4/h3
+    assert_true(map.by_role[WHITE][KNIGHT] == (occ_mask_get_knight(e5) | occ_mask_get_knight(c3)));
+    assert_true(bb_is_set(map.by_role[BLACK][PAWN], a3));
+    assert_true(bb_is_set(map.by_role[BLACK][PAWN], g2));
+
+    // cached on the position until the position changes
+    const struct attack_map *cached = pos_get_attack_map(pos);
+    assert_true(cached->by_colour[WHITE] == map.by_colour[WHITE]);
+    assert_true(pos_get_attack_map(pos) == cached);
+
+    pos_make_move(pos, move_encode_quiet(e5, d3));
+    assert_true(bb_is_set(pos_get_attack_map(pos)->by_role[WHITE][KNIGHT], b4));
+    pos_take_move(pos);
+    assert_true(pos_get_attack_map(pos)->by_role[WHITE][KNIGHT] == map.by_role[WHITE][KNIGHT]);
+
+    pos_destroy(pos);
+}
@@ -37,3 +37,5 @@ void test_att_chk_is_white_horizontal_and_vertical_attacking(void **state);
 void test_att_chk_is_black_horizontal_and_vertical_attacking(void **state);
 void test_att_chk_is_white_diagonal_attacking(void **state);
 void test_att_chk_is_black_diagonal_attacking(void **state);
+void test_att_chk_attackers_to(void **state);
+void test_att_chk_attack_map(void **state);
@@ -33,12 +33,44 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
 
-void test_hashkeys_init_to_non_zero_value(void **state) {
+// arbitrary non-zero starting hash
+#define INITIAL_HASH ((uint64_t)0x0123456789abcdefULL)
 
-    init_key_mgmt();
-    uint64_t hash = init_key_mgmt();
+#define NUM_KEYS ((NUM_PIECES * NUM_SQUARES) + 1 + NUM_SQUARES + NUM_CASTLE_PERMS)
 
-    assert_true(hash != 0);
+void test_hashkeys_keys_are_non_zero_and_unique(void **state) {
+
+    const enum piece all_pieces[] = {
+        WHITE_PAWN, WHITE_BISHOP, WHITE_KNIGHT, WHITE_ROOK, WHITE_QUEEN, WHITE_KING,
+        BLACK_PAWN, BLACK_BISHOP, BLACK_KNIGHT, BLACK_ROOK, BLACK_QUEEN, BLACK_KING,
+    };
+    const enum castle_permission cp_list[NUM_CASTLE_PERMS] = {CASTLE_PERM_NONE, CASTLE_PERM_WK, CASTLE_PERM_WQ,
+                                                              CASTLE_PERM_BK, CASTLE_PERM_BQ};
+
+    // flipping a zero hash exposes the underlying key
+    uint64_t keys[NUM_KEYS] = {0};
+    int num_keys = 0;
+
+    for (int p = 0; p < NUM_PIECES; p++) {
+        for (enum square sq = a1; sq <= h8; sq++) {
+            keys[num_keys++] = hash_piece_update(all_pieces[p], sq, 0);
+        }
+    }
+    keys[num_keys++] = hash_side_update(0);
+    for (enum square sq = a1; sq <= h8; sq++) {
+        keys[num_keys++] = hash_en_passant(sq, 0);
+    }
+    for (int i = 0; i < NUM_CASTLE_PERMS; i++) {
+        keys[num_keys++] = hash_castle_perm(cp_list[i], 0);
+    }
+    assert_int_equal(num_keys, NUM_KEYS);
+
+    for (int i = 0; i < NUM_KEYS; i++) {
+        assert_true(keys[i] != 0);
+        for (int j = i + 1; j < NUM_KEYS; j++) {
+            assert_true(keys[i] != keys[j]);
+        }
+    }
 }
 
 void test_hashkeys_all_pieces_all_squares_before_after_same(void **state) {
@@ -53,7 +85,7 @@ void test_hashkeys_all_pieces_all_squares_before_after_same(void **state) {
 
         for (enum square sq = a1; sq < h8; sq++) {
             // hash before
-            uint64_t before_hash = init_key_mgmt();
+            uint64_t before_hash = INITIAL_HASH;
 
             assert_true(before_hash != 0);
 
@@ -73,7 +105,7 @@ void test_hashkeys_all_pieces_all_squares_before_after_same(void **state) {
 
 void test_hashkeys_update_side(void **state) {
 
-    uint64_t init_hash = init_key_mgmt();
+    uint64_t init_hash = INITIAL_HASH;
 
     uint64_t after_first_flip = hash_side_update(init_hash);
     assert_true(init_hash != after_first_flip);
@@ -92,7 +124,7 @@ void test_hashkeys_update_castle_permissions(void **state) {
     for (int i = 0; i < NUM_CASTLE_PERMS; i++) {
         enum castle_permission cp = cp_list[i];
 
-        uint64_t init_hash = init_key_mgmt();
+        uint64_t init_hash = INITIAL_HASH;
 
         // initial flip
         uint64_t after_init_flip = hash_castle_perm(cp, init_hash);
@@ -111,7 +143,7 @@ void test_hashkeys_all_en_passant_squares_before_after_same(void **state) {
     for (enum square sq = a1; sq < h8; sq++) {
 
         // hash before
-        uint64_t before_hash = init_key_mgmt();
+        uint64_t before_hash = INITIAL_HASH;
         assert_true(before_hash != 0);
 
         // flip the hash for the square
@@ -30,7 +30,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 
-void test_hashkeys_init_to_non_zero_value(void **state);
+void test_hashkeys_keys_are_non_zero_and_unique(void **state);
 void test_hashkeys_all_pieces_all_squares_before_after_same(void **state);
 void test_hashkeys_update_side(void **state);
 void test_hashkeys_update_castle_permissions(void **state);
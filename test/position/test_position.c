@@ -27,8 +27,11 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
 #include "test_position.h"
+#include "bitboard.h"
 #include "board.h"
 #include "hashkeys.h"
+#include "move_gen.h"
+#include "move_list.h"
 #include "position.h"
 #include <cmocka.h>
 
@@ -2199,3 +2202,326 @@ void test_position_hash_updated_black_queen_castle(void **state) {
 }
 
 #pragma GCC diagnostic pop
+
+void test_position_is_pseudo_legal(void **state) {
+    const char *FEN = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    assert_true(pos_is_pseudo_legal(pos, move_encode_capture(e5, d7)));
+    assert_true(pos_is_pseudo_legal(pos, move_encode_capture(f3, f6)));
+    assert_true(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(a2, a4)));
+    assert_true(pos_is_pseudo_legal(pos, move_encode_castle_kingside_white()));
+    assert_true(pos_is_pseudo_legal(pos, move_encode_castle_queenside_white()));
+
+    // capture encoded as a quiet move
+    assert_false(pos_is_pseudo_legal(pos, move_encode_quiet(e5, d7)));
+    // no piece on the from square
+    assert_false(pos_is_pseudo_legal(pos, move_encode_quiet(a3, a4)));
+    // opposing piece on the from square
+    assert_false(pos_is_pseudo_legal(pos, move_encode_quiet(a6, b7)));
+    // slider blocked
+    assert_false(pos_is_pseudo_legal(pos, move_encode_capture(f3, f7)));
+    // pawn double moves blocked
+    assert_false(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(c2, c4)));
+    assert_false(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(b2, b4)));
+    // no en passant square
+    assert_false(pos_is_pseudo_legal(pos, move_encode_enpassant(d5, e6)));
+
+    pos_destroy(pos);
+}
+
+void test_position_is_pseudo_legal_rejects_single_push_as_double(void **state) {
+    struct position *pos = pos_create();
+    pos_initialise(INITIAL_FEN, pos);
+
+    assert_true(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(e2, e4)));
+    // a single push encoded as a double push would set a bogus en passant square
+    assert_false(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(e2, e3)));
+
+    pos_make_move(pos, move_encode_pawn_double_first(e2, e4));
+
+    assert_true(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(e7, e5)));
+    assert_false(pos_is_pseudo_legal(pos, move_encode_pawn_double_first(e7, e6)));
+
+    pos_destroy(pos);
+}
+
+void test_position_is_legal(void **state) {
+    // the Knight on b4 is pinned by the Bishop on c3, the pawns on d5/e5 are between the King and the Rook on h5
+    const char *FEN = "1r2k3/8/8/K2pP2r/1N6/2b5/8/8 w - d6 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    assert_true(pos_is_legal(pos, move_encode_quiet(a5, a4)));
+    assert_true(pos_is_legal(pos, move_encode_quiet(e5, e6)));
+
+    // pinned Knight
+    assert_false(pos_is_legal(pos, move_encode_quiet(b4, d3)));
+    // en passant removes both pawns from the Rook's line of attack
+    assert_false(pos_is_legal(pos, move_encode_enpassant(e5, d6)));
+    // King moving onto the b-file, attacked by the Rook on b8
+    assert_false(pos_is_legal(pos, move_encode_quiet(a5, b6)));
+
+    pos_destroy(pos);
+}
+
+void test_position_make_move_copy_matches_make_move(void **state) {
+    // Kiwipete, covers quiet moves, captures and castling on both sides
+    const char *FEN = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    struct pos_snapshot src;
+    struct pos_snapshot dst;
+    pos_save_snapshot(pos, &src);
+    struct pos_snapshot saved_src;
+    memcpy(&saved_src, &src, sizeof(struct pos_snapshot));
+
+    struct move_list mvl = mvl_initialise();
+    mv_gen_all_moves(pos, &mvl);
+    assert_true(mvl_get_move_count(&mvl) > 0);
+
+    for (uint16_t i = 0; i < mvl_get_move_count(&mvl); i++) {
+        const struct move mv = mvl_get_move_at_offset(&mvl, i);
+
+        const enum move_legality copy_legality = pos_make_move_copy(&src, &dst, mv);
+        // the source snapshot isn't modified
+        assert_true(memcmp(&src, &saved_src, sizeof(struct pos_snapshot)) == 0);
+
+        const enum move_legality legality = pos_make_move(pos, mv);
+
+        assert_true(copy_legality == legality);
+        assert_true(brd_compare(pos_get_board(pos), &dst.brd));
+        assert_true(pos_get_hash(pos) == dst.state.hashkey);
+        assert_true(pos_get_side_to_move(pos) == dst.state.side_to_move);
+        assert_true(pos_get_checkers(pos) == dst.state.checkers);
+
+        pos_take_move(pos);
+    }
+
+    pos_destroy(pos);
+}
+
+void test_position_snapshot_repetition_uses_hash_stack(void **state) {
+    const char *FEN = "4k1n1/8/8/8/8/8/8/1N2K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    // shuffle the Knights out and back, returning to the start position after 4 half-moves
+    const struct move moves[] = {move_encode_quiet(b1, c3), move_encode_quiet(g8, f6), move_encode_quiet(c3, b1),
+                                 move_encode_quiet(f6, g8)};
+    const uint32_t num_moves = sizeof(moves) / sizeof(moves[0]);
+
+    struct pos_snapshot snaps[5];
+    uint64_t hashes[5];
+    pos_save_snapshot(pos, &snaps[0]);
+
+    for (uint32_t i = 0; i < num_moves; i++) {
+        hashes[i] = snaps[i].state.hashkey;
+        assert_true(pos_make_move_copy(&snaps[i], &snaps[i + 1], moves[i]) == LEGAL_MOVE);
+    }
+
+    for (uint32_t i = 1; i < num_moves; i++) {
+        assert_false(pos_is_snapshot_repetition(&snaps[i], hashes, i));
+    }
+
+    assert_true(snaps[num_moves].state.hashkey == snaps[0].state.hashkey);
+    assert_true(pos_is_snapshot_repetition(&snaps[num_moves], hashes, num_moves));
+
+    // attaching the snapshot gives the same answers as the original position
+    pos_attach_snapshot(pos, &snaps[num_moves]);
+    assert_true(pos_get_hash(pos) == snaps[0].state.hashkey);
+    assert_true(pos_get_side_to_move(pos) == WHITE);
+
+    pos_destroy(pos);
+}
+
+void test_position_history_grows_for_long_games(void **state) {
+    const char *FEN = "4k1n1/8/8/8/8/8/8/1N2K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct position *start_pos = pos_create();
+    pos_initialise(FEN, start_pos);
+
+    // shuffle the Knights back and forth, well past the initial history capacity
+    const struct move white_moves[] = {move_encode_quiet(b1, c3), move_encode_quiet(c3, b1)};
+    const struct move black_moves[] = {move_encode_quiet(g8, f6), move_encode_quiet(f6, g8)};
+    const int num_moves = 2000;
+
+    for (int i = 0; i < num_moves; i++) {
+        const struct move mv = (i % 2 == 0) ? white_moves[(i / 2) % 2] : black_moves[(i / 2) % 2];
+        assert_true(pos_make_move(pos, mv) == LEGAL_MOVE);
+    }
+
+    for (int i = num_moves - 1; i >= 0; i--) {
+        const struct move expected = (i % 2 == 0) ? white_moves[(i / 2) % 2] : black_moves[(i / 2) % 2];
+        const struct move mv = pos_take_move(pos);
+        assert_true(move_compare(mv, expected));
+    }
+
+    assert_true(pos_compare(pos, start_pos));
+
+    pos_destroy(start_pos);
+    pos_destroy(pos);
+}
+
+void test_position_checkers_and_pinned_pieces(void **state) {
+    // the Knight on b4 is pinned by the Bishop on c3, the 2 pawns between the King and the Rook on h5 aren't pinned
+    const char *PIN_FEN = "1r2k3/8/8/K2pP2r/1N6/2b5/8/8 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(PIN_FEN, pos);
+
+    assert_false(pos_is_in_check(pos));
+    assert_true(pos_get_checkers(pos) == 0);
+    assert_true(pos_get_pinned(pos, WHITE) == SQUARE_AS_BITBOARD(b4));
+    assert_true(pos_get_pinned(pos, BLACK) == 0);
+
+    pos_destroy(pos);
+
+    // White King in check from the Rook on e2
+    const char *CHECK_FEN = "4k3/8/8/8/8/8/4r3/R3K3 w - - 0 1\n";
+
+    pos = pos_create();
+    pos_initialise(CHECK_FEN, pos);
+
+    assert_true(pos_is_in_check(pos));
+    assert_true(pos_get_checkers(pos) == SQUARE_AS_BITBOARD(e2));
+
+    assert_true(pos_make_move(pos, move_encode_capture(e1, e2)) == LEGAL_MOVE);
+    assert_false(pos_is_in_check(pos));
+    assert_true(pos_get_checkers(pos) == 0);
+
+    // restored on unmake
+    pos_take_move(pos);
+    assert_true(pos_is_in_check(pos));
+    assert_true(pos_get_checkers(pos) == SQUARE_AS_BITBOARD(e2));
+
+    pos_destroy(pos);
+}
+
+void test_position_null_move(void **state) {
+    const char *FEN = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/Pp2P3/2N2Q1p/1PPBBPPP/R3K2R b KQkq a3 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+    struct position *start_pos = pos_create();
+    pos_initialise(FEN, start_pos);
+
+    const uint64_t start_hash = pos_get_hash(pos);
+
+    pos_make_null_move(pos);
+
+    assert_true(pos_get_side_to_move(pos) == WHITE);
+    assert_false(pos_is_en_passant_active(pos));
+    assert_true(pos_get_hash(pos) != start_hash);
+    assert_true(brd_compare(pos_get_board(pos), pos_get_board(start_pos)));
+
+    pos_take_null_move(pos);
+
+    assert_true(pos_get_hash(pos) == start_hash);
+    assert_true(pos_compare(pos, start_pos));
+
+    pos_destroy(start_pos);
+    pos_destroy(pos);
+}
+
+void test_position_null_move_keeps_fifty_move_counter(void **state) {
+    const char *FEN = "4k1n1/8/8/8/8/8/8/1N2K3 w - - 99 60\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    assert_true(pos_get_fifty_move_counter(pos) == 99);
+
+    // the null move counts as a reversible move
+    pos_make_null_move(pos);
+    assert_true(pos_get_fifty_move_counter(pos) == 100);
+    assert_true(pos_is_fifty_move_draw(pos));
+
+    pos_take_null_move(pos);
+    assert_true(pos_get_fifty_move_counter(pos) == 99);
+    assert_false(pos_is_fifty_move_draw(pos));
+
+    // back to the start position, but repetitions can't span a null move
+    pos_make_move(pos, move_encode_quiet(b1, c3));
+    pos_make_null_move(pos);
+    pos_make_move(pos, move_encode_quiet(c3, b1));
+    pos_make_null_move(pos);
+    assert_true(pos_get_fifty_move_counter(pos) == 103);
+    assert_false(pos_is_repetition(pos));
+
+    pos_destroy(pos);
+}
+
+void test_position_repetition(void **state) {
+    const char *FEN = "4k1n1/p7/8/8/8/8/P7/1N2K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    assert_false(pos_is_repetition(pos));
+
+    pos_make_move(pos, move_encode_quiet(b1, c3));
+    pos_make_move(pos, move_encode_quiet(g8, f6));
+    assert_false(pos_is_repetition(pos));
+    pos_make_move(pos, move_encode_quiet(c3, b1));
+    assert_false(pos_is_repetition(pos));
+    pos_make_move(pos, move_encode_quiet(f6, g8));
+    // back to the starting position
+    assert_true(pos_is_repetition(pos));
+
+    pos_take_move(pos);
+    assert_false(pos_is_repetition(pos));
+    pos_make_move(pos, move_encode_quiet(f6, g8));
+    assert_true(pos_is_repetition(pos));
+
+    // a pawn move can't be reversed, so the earlier positions can't repeat
+    pos_make_move(pos, move_encode_quiet(a2, a3));
+    pos_make_move(pos, move_encode_quiet(a7, a6));
+    pos_make_move(pos, move_encode_quiet(b1, c3));
+    pos_make_move(pos, move_encode_quiet(g8, f6));
+    pos_make_move(pos, move_encode_quiet(c3, b1));
+    pos_make_move(pos, move_encode_quiet(f6, g8));
+    assert_true(pos_is_repetition(pos));
+    assert_true(pos_get_fifty_move_counter(pos) == 4);
+
+    pos_destroy(pos);
+}
+
+void test_position_fifty_move_counter(void **state) {
+    const char *FEN = "4k3/p7/8/8/8/8/8/1N2K2r w - - 98 60\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    assert_true(pos_get_fifty_move_counter(pos) == 98);
+    assert_false(pos_is_fifty_move_draw(pos));
+
+    pos_make_move(pos, move_encode_quiet(b1, c3));
+    assert_true(pos_get_fifty_move_counter(pos) == 99);
+    pos_make_move(pos, move_encode_quiet(e8, d8));
+    assert_true(pos_get_fifty_move_counter(pos) == 100);
+    assert_true(pos_is_fifty_move_draw(pos));
+
+    // restored on unmake
+    pos_take_move(pos);
+    assert_true(pos_get_fifty_move_counter(pos) == 99);
+
+    // pawn moves and captures reset the counter
+    pos_make_move(pos, move_encode_quiet(a7, a6));
+    assert_true(pos_get_fifty_move_counter(pos) == 0);
+    pos_take_move(pos);
+    pos_make_move(pos, move_encode_quiet(h1, g1));
+    pos_make_move(pos, move_encode_quiet(c3, b1));
+    pos_make_move(pos, move_encode_capture(g1, b1));
+    assert_true(pos_get_fifty_move_counter(pos) == 0);
+
+    pos_destroy(pos);
+}
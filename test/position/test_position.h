@@ -102,3 +102,14 @@ void test_position_hash_updated_white_king_castle(void **state);
 void test_position_hash_updated_white_queen_castle(void **state);
 void test_position_hash_updated_black_king_castle(void **state);
 void test_position_hash_updated_black_queen_castle(void **state);
+void test_position_is_pseudo_legal(void **state);
+void test_position_is_pseudo_legal_rejects_single_push_as_double(void **state);
+void test_position_is_legal(void **state);
+void test_position_make_move_copy_matches_make_move(void **state);
+void test_position_snapshot_repetition_uses_hash_stack(void **state);
+void test_position_history_grows_for_long_games(void **state);
+void test_position_checkers_and_pinned_pieces(void **state);
+void test_position_null_move(void **state);
+void test_position_null_move_keeps_fifty_move_counter(void **state);
+void test_position_repetition(void **state);
+void test_position_fifty_move_counter(void **state);
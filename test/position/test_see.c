@@ -0,0 +1,125 @@
+/*  MIT License
+ *
+ *  Copyright (c) 2017 Eddie McNally
+ *
+ *  Permission is hereby granted, free of charge, to any person 
+ *  obtaining a copy of this software and associated documentation 
+ *  files (the "Software"), to deal in the Software without 
+ *  restriction, including without limitation the rights to use, 
+ *  copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the 
+ *  Software is furnished to do so, subject to the following 
+ *  conditions:
+ *
+ *  The above copyright notice and this permission notice shall be 
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ *  OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS 
+ *  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN 
+ *  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+ *  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include "test_see.h"
+#include "move.h"
+#include "position.h"
+#include "see.h"
+#include <cmocka.h>
+
+void test_see_undefended_capture(void **state) {
+    const char *FEN = "4k3/8/3n4/4P3/8/8/8/4K3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    // wins a Knight
+    const struct move mv = move_encode_capture(e5, d6);
+    assert_true(see_ge(pos, mv, 0));
+    assert_true(see_ge(pos, mv, 320));
+    assert_false(see_ge(pos, mv, 321));
+
+    pos_destroy(pos);
+}
+
+void test_see_defended_capture(void **state) {
+    const char *FEN = "4k3/2p5/3n4/8/8/8/8/3QK3 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    // wins a Knight, loses the Queen to the pawn
+    const struct move mv = move_encode_capture(d1, d6);
+    assert_false(see_ge(pos, mv, 0));
+    assert_true(see_ge(pos, mv, 320 - 900));
+    assert_false(see_ge(pos, mv, 320 - 900 + 1));
+
+    pos_destroy(pos);
+}
+
+void test_see_x_ray_attacker(void **state) {
+    // the Rook on e1 supports the capture once the Rook on e2 has moved
+    const char *FEN = "4k3/4r3/8/4p3/8/8/4R3/4RK2 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    const struct move mv = move_encode_capture(e2, e5);
+    assert_true(see_ge(pos, mv, 100));
+    assert_false(see_ge(pos, mv, 101));
+
+    pos_destroy(pos);
+
+    // without the supporting Rook, the capture loses the exchange
+    const char *NO_XRAY_FEN = "4k3/4r3/8/4p3/8/8/4R3/5K2 w - - 0 1\n";
+
+    pos = pos_create();
+    pos_initialise(NO_XRAY_FEN, pos);
+
+    assert_false(see_ge(pos, mv, 0));
+    assert_true(see_ge(pos, mv, 100 - 500));
+
+    pos_destroy(pos);
+}
+
+void test_see_en_passant(void **state) {
+    const char *FEN = "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    const struct move mv = move_encode_enpassant(e5, d6);
+    assert_true(see_ge(pos, mv, 100));
+    assert_false(see_ge(pos, mv, 101));
+
+    pos_destroy(pos);
+}
+
+void test_see_king_recapture(void **state) {
+    // the pawn is only defended by the King
+    const char *FEN = "8/8/8/8/8/4k3/3p4/3R1K2 w - - 0 1\n";
+
+    struct position *pos = pos_create();
+    pos_initialise(FEN, pos);
+
+    const struct move mv = move_encode_capture(d1, d2);
+    assert_false(see_ge(pos, mv, 0));
+
+    pos_destroy(pos);
+
+    // the Knight defends d2, so the King can't recapture
+    const char *DEFENDED_FEN = "8/8/8/8/8/1N2k3/3p4/3R1K2 w - - 0 1\n";
+
+    pos = pos_create();
+    pos_initialise(DEFENDED_FEN, pos);
+
+    assert_true(see_ge(pos, mv, 100));
+    assert_false(see_ge(pos, mv, 101));
+
+    pos_destroy(pos);
+}
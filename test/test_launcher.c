@@ -29,6 +29,7 @@
 #include "test_attack_checker.h"
 #include "test_basic_evaluator.h"
 #include "test_bitboard.h"
+#include "test_magic_bitboard.h"
 #include "test_board.h"
 #include "test_castle_permissions.h"
 #include "test_fen.h"
@@ -36,9 +37,12 @@
 #include "test_move.h"
 #include "test_move_gen.h"
 #include "test_move_list.h"
+#include "test_move_picker.h"
+#include "test_move_stack.h"
 #include "test_perft.h"
 #include "test_piece.h"
 #include "test_position.h"
+#include "test_see.h"
 #include "test_square.h"
 #include "test_transposition_table.h"
 #include <setjmp.h>
@@ -77,12 +81,18 @@ int main(void) {
         TEST(test_move_black_king_castle_encode_decode),
 
         TEST(test_move_double_pawn_move_encode_decode),
+        TEST(test_move_packed_into_16_bits),
 
         // move list
         TEST(test_move_list_init),
         TEST(test_move_list_bulk_add_moves),
         TEST(test_move_list_reset_list),
 
+        // Move Stack
+        TEST(test_move_stack_push_pop),
+        TEST(test_move_stack_pushed_list_is_empty),
+        TEST(test_move_stack_lists_are_independent),
+
         // Pieces
         TEST(test_piece_get_colour_white_pieces),
         TEST(test_piece_get_colour_black_pieces),
@@ -163,6 +173,17 @@ int main(void) {
         TEST(test_position_hash_updated_white_queen_castle),
         TEST(test_position_hash_updated_black_king_castle),
         TEST(test_position_hash_updated_black_queen_castle),
+        TEST(test_position_is_pseudo_legal),
+        TEST(test_position_is_pseudo_legal_rejects_single_push_as_double),
+        TEST(test_position_is_legal),
+        TEST(test_position_make_move_copy_matches_make_move),
+        TEST(test_position_snapshot_repetition_uses_hash_stack),
+        TEST(test_position_history_grows_for_long_games),
+        TEST(test_position_checkers_and_pinned_pieces),
+        TEST(test_position_null_move),
+        TEST(test_position_null_move_keeps_fifty_move_counter),
+        TEST(test_position_repetition),
+        TEST(test_position_fifty_move_counter),
 
         // position evaluation
         TEST(test_basic_evaluator_sample_white_position),
@@ -171,9 +192,17 @@ int main(void) {
         // search
         TEST(test_transposition_table_create_different_sizes_as_expected),
         TEST(test_transposition_table_add_multiple_all_present),
+        TEST(test_transposition_table_full_bucket_replaces_shallowest_entry),
+        TEST(test_transposition_table_same_position_replaced_by_depth_and_age),
+        TEST(test_transposition_table_old_entries_replaced_before_deeper_new_entries),
+        TEST(test_transposition_table_capacity_matches_size),
+        TEST(test_transposition_table_resize_clears_table),
+        TEST(test_transposition_table_concurrent_access_no_torn_entries),
+        TEST(test_transposition_table_page_size_reported),
+        TEST(test_transposition_table_cleared_across_threads),
 
         // hashkey mgmt
-        TEST(test_hashkeys_init_to_non_zero_value),
+        TEST(test_hashkeys_keys_are_non_zero_and_unique),
         TEST(test_hashkeys_all_pieces_all_squares_before_after_same),
         TEST(test_hashkeys_update_side),
         TEST(test_hashkeys_update_castle_permissions),
@@ -185,6 +214,12 @@ int main(void) {
         TEST(test_bitboard_set_test_clear_bit),
         TEST(test_bitboard_reverse_bits),
 
+        // slider attacks
+        TEST(test_magic_bitboard_slider_attacks_match_reference),
+        TEST(test_magic_bitboard_magic_backend_matches_reference),
+        TEST(test_magic_bitboard_pext_backend_matches_reference),
+        TEST(test_magic_bitboard_default_backend_is_fast_path),
+
         // board
         TEST(test_board_brd_allocate_deallocate),
         TEST(test_board_brd_bulk_add_remove_piece),
@@ -267,6 +302,24 @@ int main(void) {
         TEST(test_move_all_moves_4_knights_opening_white_to_move),
         TEST(test_move_white_capture_only_moves),
         TEST(test_move_black_capture_only_moves),
+        TEST(test_move_legal_moves_pinned_piece),
+        TEST(test_move_legal_moves_en_passant_discovered_check),
+        TEST(test_move_legal_moves_en_passant_evades_check),
+        TEST(test_move_legal_moves_castle_through_attack),
+        TEST(test_move_legal_moves_double_check),
+        TEST(test_move_gen_evasions_single_check),
+        TEST(test_move_gen_evasions_en_passant_captures_checker),
+        TEST(test_move_gen_quiet_checks_direct),
+        TEST(test_move_gen_quiet_checks_discovered),
+        TEST(test_move_count_legal_moves_matches_generator),
+
+        // Move Picker
+        TEST(test_move_picker_returns_all_moves),
+        TEST(test_move_picker_stage_order),
+        TEST(test_move_picker_invalid_tt_and_killer_moves_skipped),
+        TEST(test_move_picker_malformed_double_push_skipped),
+        TEST(test_move_picker_tt_move_does_not_generate_moves),
+        TEST(test_move_picker_in_check_only_returns_evasions),
 
         // attack checker
         TEST(test_att_chk_is_white_pawn_attacking),
@@ -279,6 +332,15 @@ int main(void) {
         TEST(test_att_chk_is_black_horizontal_and_vertical_attacking),
         TEST(test_att_chk_is_white_diagonal_attacking),
         TEST(test_att_chk_is_black_diagonal_attacking),
+        TEST(test_att_chk_attackers_to),
+        TEST(test_att_chk_attack_map),
+
+        // static exchange evaluation
+        TEST(test_see_undefended_capture),
+        TEST(test_see_defended_capture),
+        TEST(test_see_x_ray_attacker),
+        TEST(test_see_en_passant),
+        TEST(test_see_king_recapture),
 
         // castle permissions
         TEST(test_castle_permissions_get_set),
@@ -0,0 +1,278 @@
+#
+#                               K2 Chess Engine
+#
+#   Generates the pre-calculated occupancy mask and Zobrist hash key tables
+#   as C headers, so the engine doesn't need to build them at runtime.
+#
+#   Usage (from the repository root):
+#       python3 tools/table_gen.py
+#
+#   Writes:
+#       src/board/bitboard/occupancy_mask_tables.h
+#       src/position/hashkeys_tables.h
+#
+#   The generated headers are checked in; re-run this script if the board
+#   layout or the hash key scheme changes.
+#
+
+import os
+
+NUM_SQUARES = 64
+NUM_COLOURS = 2
+NUM_PIECE_ROLES = 6
+NUM_CASTLE_PERMS = 5
+
+MASK_64 = (1 << 64) - 1
+
+REPO_ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), '..'))
+OCC_MASK_HEADER = os.path.join(REPO_ROOT, 'src', 'board', 'bitboard', 'occupancy_mask_tables.h')
+HASHKEYS_HEADER = os.path.join(REPO_ROOT, 'src', 'position', 'hashkeys_tables.h')
+
+
+# ------------------------------------------------------------------
+#
+# 64-bit Mersenne Twister (MT19937-64), matching src/utils/rand.c
+#
+# ------------------------------------------------------------------
+class MersenneTwister64:
+    NN = 312
+    MM = 156
+    MATRIX_A = 0xB5026F5AA96619E9
+    UM = 0xFFFFFFFF80000000
+    LM = 0x7FFFFFFF
+
+    def __init__(self):
+        self.mt = [0] * self.NN
+        self.mti = self.NN + 1
+
+    def init_genrand64(self, seed):
+        self.mt[0] = seed & MASK_64
+        for i in range(1, self.NN):
+            prev = self.mt[i - 1]
+            self.mt[i] = (6364136223846793005 * (prev ^ (prev >> 62)) + i) & MASK_64
+        self.mti = self.NN
+
+    def init_by_array64(self, init_key):
+        self.init_genrand64(19650218)
+        i = 1
+        j = 0
+        key_length = len(init_key)
+        for _ in range(max(self.NN, key_length)):
+            prev = self.mt[i - 1]
+            self.mt[i] = ((self.mt[i] ^ (((prev ^ (prev >> 62)) * 3935559000370003845) & MASK_64))
+                          + init_key[j] + j) & MASK_64
+            i += 1
+            j += 1
+            if i >= self.NN:
+                self.mt[0] = self.mt[self.NN - 1]
+                i = 1
+            if j >= key_length:
+                j = 0
+        for _ in range(self.NN - 1):
+            prev = self.mt[i - 1]
+            self.mt[i] = ((self.mt[i] ^ (((prev ^ (prev >> 62)) * 2862933555777941757) & MASK_64)) - i) & MASK_64
+            i += 1
+            if i >= self.NN:
+                self.mt[0] = self.mt[self.NN - 1]
+                i = 1
+        self.mt[0] = 1 << 63
+
+    def genrand64_int64(self):
+        mag01 = (0, self.MATRIX_A)
+        if self.mti >= self.NN:
+            if self.mti == self.NN + 1:
+                self.init_genrand64(5489)
+            for i in range(self.NN):
+                x = (self.mt[i] & self.UM) | (self.mt[(i + 1) % self.NN] & self.LM)
+                self.mt[i] = self.mt[(i + self.MM) % self.NN] ^ (x >> 1) ^ mag01[x & 1]
+            self.mti = 0
+
+        x = self.mt[self.mti]
+        self.mti += 1
+
+        x ^= (x >> 29) & 0x5555555555555555
+        x ^= (x << 17) & 0x71D67FFFEDA60000
+        x ^= (x << 37) & 0xFFF7EEE000000000
+        x ^= (x >> 43)
+        return x & MASK_64
+
+
+# ------------------------------------------------------------------
+#
+# Occupancy masks
+#
+# ------------------------------------------------------------------
+def sq_bb(rank, file):
+    return 1 << (rank * 8 + file)
+
+
+def on_board(rank, file):
+    return 0 <= rank < 8 and 0 <= file < 8
+
+
+def step_mask(sq, deltas):
+    rank, file = divmod(sq, 8)
+    bb = 0
+    for dr, df in deltas:
+        if on_board(rank + dr, file + df):
+            bb |= sq_bb(rank + dr, file + df)
+    return bb
+
+
+def ray_mask(sq, deltas):
+    rank, file = divmod(sq, 8)
+    bb = 0
+    for dr, df in deltas:
+        r, f = rank + dr, file + df
+        while on_board(r, f):
+            bb |= sq_bb(r, f)
+            r, f = r + dr, f + df
+    return bb
+
+
+def in_between(sq1, sq2):
+    # see https://www.chessprogramming.org/Square_Attacked_By#LegalityTest
+    r1, f1 = divmod(sq1, 8)
+    r2, f2 = divmod(sq2, 8)
+    dr, df = r2 - r1, f2 - f1
+    if sq1 == sq2 or not (dr == 0 or df == 0 or abs(dr) == abs(df)):
+        return 0
+    step_r = (dr > 0) - (dr < 0)
+    step_f = (df > 0) - (df < 0)
+    bb = 0
+    r, f = r1 + step_r, f1 + step_f
+    while (r, f) != (r2, f2):
+        bb |= sq_bb(r, f)
+        r, f = r + step_r, f + step_f
+    return bb
+
+
+KNIGHT_DELTAS = [(2, -1), (-2, -1), (1, -2), (-1, -2), (2, 1), (-2, 1), (1, 2), (-1, 2)]
+KING_DELTAS = [(1, -1), (1, 0), (1, 1), (0, -1), (0, 1), (-1, 1), (-1, 0), (-1, -1)]
+POSITIVE_DIAGONAL = [(1, 1), (-1, -1)]
+NEGATIVE_DIAGONAL = [(1, -1), (-1, 1)]
+
+
+def rook_mask(sq):
+    # includes the square itself, matching occ_mask_get_horizontal() | occ_mask_get_vertical()
+    rank, file = divmod(sq, 8)
+    return (0xff << (rank * 8)) | (0x0101010101010101 << file)
+
+
+# ------------------------------------------------------------------
+#
+# Output
+#
+# ------------------------------------------------------------------
+FILE_HEADER = '''/*
+ * This file is generated by tools/table_gen.py - DO NOT EDIT.
+ */
+
+#pragma once
+
+{}#include <stdint.h>
+
+// clang-format off
+'''
+
+FILE_FOOTER = '''
+// clang-format on
+'''
+
+
+def fmt(value):
+    return '0x{:016x}ULL'.format(value)
+
+
+def gen_occupancy_mask_header():
+    out = [FILE_HEADER.format('#include "occupancy_mask.h"\n#include "square.h"\n')]
+
+    out.append('\nstatic const uint64_t in_between_sq[NUM_SQUARES][NUM_SQUARES] = {\n')
+    for sq1 in range(NUM_SQUARES):
+        out.append('    {\n')
+        row = [in_between(sq1, sq2) for sq2 in range(NUM_SQUARES)]
+        for i in range(0, NUM_SQUARES, 4):
+            out.append('        ' + ', '.join(fmt(v) for v in row[i:i + 4]) + ',\n')
+        out.append('    },\n')
+    out.append('};\n')
+
+    out.append('\nstatic const uint64_t knight_occupancy_masks[NUM_SQUARES] = {\n')
+    out.append(emit_rows([step_mask(sq, KNIGHT_DELTAS) for sq in range(NUM_SQUARES)]))
+    out.append('};\n')
+
+    out.append('\nstatic const uint64_t king_occupancy_masks[NUM_SQUARES] = {\n')
+    out.append(emit_rows([step_mask(sq, KING_DELTAS) for sq in range(NUM_SQUARES)]))
+    out.append('};\n')
+
+    out.append('\nstatic const struct diagonals diagonal_masks[NUM_SQUARES] = {\n')
+    for sq in range(NUM_SQUARES):
+        out.append('    {{{}, {}}},\n'.format(fmt(ray_mask(sq, POSITIVE_DIAGONAL)), fmt(ray_mask(sq, NEGATIVE_DIAGONAL))))
+    out.append('};\n')
+
+    out.append('\nstatic const uint64_t queen_occupancy_masks[NUM_SQUARES] = {\n')
+    out.append(emit_rows([(rook_mask(sq) | ray_mask(sq, POSITIVE_DIAGONAL + NEGATIVE_DIAGONAL)) & ~(1 << sq)
+                          for sq in range(NUM_SQUARES)]))
+    out.append('};\n')
+
+    out.append('\nstatic const uint64_t rook_occupancy_masks[NUM_SQUARES] = {\n')
+    out.append(emit_rows([rook_mask(sq) for sq in range(NUM_SQUARES)]))
+    out.append('};\n')
+
+    out.append(FILE_FOOTER)
+    return ''.join(out)
+
+
+def gen_hashkeys_header():
+    prng = MersenneTwister64()
+    prng.init_by_array64([0x12345, 0x23456, 0x34567, 0x45678])
+
+    # NOTE: the generation order is significant, since it determines the key values
+    piece_keys = [[[prng.genrand64_int64() for _ in range(NUM_SQUARES)]
+                   for _ in range(NUM_COLOURS)]
+                  for _ in range(NUM_PIECE_ROLES)]
+    side_key = prng.genrand64_int64()
+    en_passant_sq_keys = [prng.genrand64_int64() for _ in range(NUM_SQUARES)]
+    castle_keys = [prng.genrand64_int64() for _ in range(NUM_CASTLE_PERMS)]
+
+    out = [FILE_HEADER.format('#include "castle_perms.h"\n#include "piece.h"\n#include "square.h"\n')]
+
+    out.append('\nstatic const uint64_t piece_keys[NUM_PIECE_ROLES][NUM_COLOURS][NUM_SQUARES] = {\n')
+    for role_keys in piece_keys:
+        out.append('    {\n')
+        for colour_keys in role_keys:
+            out.append('        {\n')
+            out.append(emit_rows(colour_keys, indent='            '))
+            out.append('        },\n')
+        out.append('    },\n')
+    out.append('};\n')
+
+    out.append('\nstatic const uint64_t side_key = {};\n'.format(fmt(side_key)))
+
+    out.append('\nstatic const uint64_t castle_keys[NUM_CASTLE_PERMS] = {\n')
+    out.append(emit_rows(castle_keys))
+    out.append('};\n')
+
+    out.append('\nstatic const uint64_t en_passant_sq_keys[NUM_SQUARES] = {\n')
+    out.append(emit_rows(en_passant_sq_keys))
+    out.append('};\n')
+
+    out.append(FILE_FOOTER)
+    return ''.join(out)
+
+
+def emit_rows(values, per_line=4, indent='    '):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',\n')
+    return ''.join(lines)
+
+
+def write_file(path, contents):
+    with open(path, 'w') as f:
+        f.write(contents)
+    print('Generated {}'.format(os.path.relpath(path, REPO_ROOT)))
+
+
+if __name__ == '__main__':
+    write_file(OCC_MASK_HEADER, gen_occupancy_mask_header())
+    write_file(HASHKEYS_HEADER, gen_hashkeys_header())